@@ -0,0 +1,108 @@
+//======================================================================================================
+//
+//	File:		CellWidthBench.cpp
+//	Created:	Wednesday, 21 October 2026 10:12:41
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	Compares GetTextWidth() with wcwidth() called for every character.
+//
+//	Usage: CellWidthBench [characters per text] [repeats]
+//
+//	wcwidth() is POSIX, so this benchmark builds only where wchar_t has 32 bits (Linux, macOS).
+//
+//======================================================================================================
+
+#include "ConsoleCellWidth.h"
+
+#include <chrono>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <wchar.h>
+
+using namespace WindowConsole;
+
+struct Sample
+{
+	const char *name;
+	const wchar_t *words[8];
+};
+
+// text is built from random words of a sample, separated with spaces
+static const Sample Samples[] =
+{
+	{"ascii",    {L"status", L"ok", L"12.5%", L"worker", L"[done]", L"queue:", L"0x1F", L"retry"}},
+	{"latin",    {L"za\u017C\u00F3\u0142\u0107", L"gesch\u00E4ft", L"cafe\u0301", L"n\u0303o", L"\u00E9t\u00E9", L"stra\u00DFe", L"ok", L"A\u030Angstro\u0308m"}},
+	{"cjk",      {L"\u4E2D\u6587", L"\u65E5\u672C\u8A9E", L"\uD55C\uAD6D\uC5B4", L"\u30C6\u30B9\u30C8", L"ok", L"\u8868", L"\u5B8C\u4E86", L"\uFF21\uFF22"}},
+	{"emoji",    {L"\U0001F600", L"\U0001F44D\U0001F3FD", L"\U0001F468\u200D\U0001F469\u200D\U0001F467", L"\U0001F1F5\U0001F1F1",
+	              L"\u2764\uFE0F", L"\U0001F525", L"\U0001F3F3\uFE0F\u200D\U0001F308", L"ok"}}
+};
+
+// returns time of the fastest call in microseconds
+static double Measure(const std::function<void()> &inFunction, int inRepeats)
+{
+	double best = 0;
+	for(int i = 0; i <= inRepeats; ++i)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		inFunction();
+		double time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+		// the first call warms up caches and is not measured
+		if( (i == 1) || ( (i > 1) && (time < best) ) )
+			best = time;
+	}
+	return best;
+}
+
+int main(int argc, char **argv)
+{
+	const size_t characters = argc > 1 ? (size_t)std::atol(argv[1]) : 100000;
+	const int repeats = argc > 2 ? std::atoi(argv[2]) : 100;
+
+	if( std::setlocale(LC_ALL, "C.UTF-8") == NULL )
+		std::setlocale(LC_ALL, "en_US.UTF-8");
+
+	std::printf("%zu characters per text, %d repeats\n", characters, repeats);
+	std::printf("%-8s %12s %12s %9s %9s %9s\n", "text", "wcwidth us", "engine us", "speedup", "wcwidth", "engine");
+
+	for(size_t s = 0; s < sizeof(Samples) / sizeof(Samples[0]); ++s)
+	{
+		std::wstring text;
+		std::srand(1);
+		while( text.length() < characters )
+		{
+			text += Samples[s].words[std::rand() % 8];
+			text += L' ';
+		}
+
+		int wcwidthResult = 0;
+		double wcwidthTime = Measure([&]()
+		{
+			int width = 0;
+			for(size_t i = 0; i < text.length(); ++i)
+			{
+				int characterWidth = wcwidth(text[i]);
+				if( characterWidth > 0 )
+					width += characterWidth;
+			}
+			wcwidthResult = width;
+		}, repeats);
+
+		int engineResult = 0;
+		double engineTime = Measure([&]()
+		{
+			engineResult = GetTextWidth(text);
+		}, repeats);
+
+		// widths differ where wcwidth() does not know clusters, e.g. emoji joined with ZWJ
+		std::printf("%-8s %12.1f %12.1f %8.2fx %9d %9d\n", Samples[s].name, wcwidthTime, engineTime, wcwidthTime / engineTime, wcwidthResult, engineResult);
+	}
+
+	return 0;
+}
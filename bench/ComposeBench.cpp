@@ -0,0 +1,83 @@
+//======================================================================================================
+//
+//	File:		ComposeBench.cpp
+//	Created:	Tuesday, 20 October 2026 11:02:37
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	Measures how ConsoleCanvas::Compose() scales from 1 to N threads.
+//
+//	Usage: ComposeBench [width] [height] [frames] [max threads]
+//
+//======================================================================================================
+
+#include "ConsoleCanvas.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+using namespace WindowConsole;
+
+// renders a moving plasma, a few floating point operations per cell like a chart or a heat map
+static void RenderPlasma(ConsoleCanvas &ioCanvas, short inFirstRow, short inLastRow, int inFrame)
+{
+	static const wchar_t Shades[] = L" .:-=+*#%@";
+	const double time = inFrame * 0.05;
+
+	for(short y = inFirstRow; y < inLastRow; ++y)
+	{
+		wchar_t *characters = ioCanvas.GetRowCharacters(y);
+		unsigned short *attributes = ioCanvas.GetRowAttributes(y);
+		for(short x = 0; x < ioCanvas.GetWidth(); ++x)
+		{
+			double value = std::sin(x * 0.07 + time) + std::sin(y * 0.11 - time) + std::sin((x + y) * 0.05 + time * 0.5);
+			int level = (int)((value + 3.0) / 6.0 * 9.99);
+			characters[x] = Shades[level];
+			attributes[x] = (unsigned short)(1 + level % 15);
+		}
+	}
+}
+
+int main(int argc, char **argv)
+{
+	const short width = (short)(argc > 1 ? std::atoi(argv[1]) : 400);
+	const short height = (short)(argc > 2 ? std::atoi(argv[2]) : 300);
+	const int frames = argc > 3 ? std::atoi(argv[3]) : 200;
+	const unsigned maxThreads = argc > 4 ? (unsigned)std::atoi(argv[4]) : std::max(std::thread::hardware_concurrency(), 1u);
+
+	ConsoleCanvas canvas(width, height);
+	std::printf("canvas %dx%d, %d frames, %u hardware threads\n", width, height, frames, std::thread::hardware_concurrency());
+	std::printf("%8s %12s %10s %9s\n", "threads", "us/frame", "frames/s", "speedup");
+
+	double singleThreadTime = 0;
+	for(unsigned threads = 1; threads <= maxThreads; ++threads)
+	{
+		int frame = 0;
+		ConsoleCanvas::ComposeFunction render = [&frame](ConsoleCanvas &ioCanvas, short inFirstRow, short inLastRow)
+		{
+			RenderPlasma(ioCanvas, inFirstRow, inLastRow, frame);
+		};
+
+		// the first frame starts pool threads, it is not measured
+		canvas.Compose(render, 8, threads);
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for(frame = 0; frame < frames; ++frame)
+		{
+			canvas.Compose(render, 8, threads);
+		}
+		double time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / frames;
+
+		if( threads == 1 )
+			singleThreadTime = time;
+		std::printf("%8u %12.1f %10.1f %8.2fx\n", threads, time, 1000000.0 / time, singleThreadTime / time);
+	}
+
+	return 0;
+}
@@ -0,0 +1,132 @@
+//======================================================================================================
+//
+//	File:		KernelBench.cpp
+//	Created:	Tuesday, 20 October 2026 12:20:14
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	Compares scalar, SSE2 and AVX2 cell kernels on 80x25, 240x80 and 1000x1000 grids.
+//
+//	Usage: KernelBench [cells per measurement]
+//
+//======================================================================================================
+
+#include "ConsoleKernels.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+using namespace WindowConsole;
+
+struct Grid
+{
+	int width, height;
+};
+
+static const char * const KernelSetNames[] = {"Scalar", "SSE2", "AVX2"};
+
+// returns time of a single call in microseconds
+static double Measure(const std::function<void()> &inFunction, int inIterations)
+{
+	inFunction();
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for(int i = 0; i < inIterations; ++i)
+	{
+		inFunction();
+	}
+	return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / inIterations;
+}
+
+int main(int argc, char **argv)
+{
+	const double cellsPerMeasurement = argc > 1 ? std::atof(argv[1]) : 200000000.0;
+	const Grid grids[] = {{80, 25}, {240, 80}, {1000, 1000}};
+	const KernelSet best = GetKernelSet();
+
+	std::printf("best kernel set: %s\n", KernelSetNames[best]);
+	std::printf("%-10s %-7s %12s %12s %12s %12s\n", "grid", "kernels", "fill us", "remap us", "diff us", "diff 1% us");
+
+	for(size_t g = 0; g < sizeof(grids) / sizeof(grids[0]); ++g)
+	{
+		const size_t count = (size_t)grids[g].width * grids[g].height;
+		const int iterations = (int)(cellsPerMeasurement / count) + 1;
+
+		std::vector<wchar_t> characters(count, L' '), oldCharacters(count, L' ');
+		std::vector<unsigned short> attributes(count, 0x07), oldAttributes(count, 0x07);
+
+		// one cell in a hundred differs, in runs of one to four cells like a changing status table
+		std::vector<wchar_t> changedCharacters(characters);
+		std::srand(1);
+		for(size_t i = 0; i < count; i += 100)
+		{
+			size_t length = 1 + std::rand() % 4;
+			for(size_t j = i; (j < i + length) && (j < count); ++j)
+				changedCharacters[j] = L'#';
+		}
+
+		double scalarTimes[4] = {0, 0, 0, 0};
+		for(int set = Scalar; set <= AVX2; ++set)
+		{
+			if( SetKernelSet((KernelSet)set) != (KernelSet)set )
+				continue;
+
+			double times[4];
+			size_t sink = 0;
+
+			times[0] = Measure([&]()
+			{
+				FillCharacters(characters.data(), L' ', count);
+				FillAttributes(attributes.data(), 0x07, count);
+			}, iterations);
+
+			times[1] = Measure([&]()
+			{
+				RemapBackground(attributes.data(), 0x01, count);
+			}, iterations);
+
+			// identical frames, the whole grid is scanned
+			times[2] = Measure([&]()
+			{
+				size_t length;
+				sink += FindChangedRun(characters.data(), attributes.data(), oldCharacters.data(), oldAttributes.data(), count, 0, length);
+			}, iterations);
+
+			// every changed run is found, like Present() does
+			times[3] = Measure([&]()
+			{
+				size_t length = 0;
+				for(size_t first = FindChangedRun(changedCharacters.data(), attributes.data(), oldCharacters.data(), oldAttributes.data(), count, 0, length);
+					first < count;
+					first = FindChangedRun(changedCharacters.data(), attributes.data(), oldCharacters.data(), oldAttributes.data(), count, first + length, length))
+				{
+					sink += length;
+				}
+			}, iterations);
+
+			if( set == Scalar )
+				std::copy(times, times + 4, scalarTimes);
+
+			char name[32];
+			std::sprintf(name, "%dx%d", grids[g].width, grids[g].height);
+			std::printf("%-10s %-7s", name, KernelSetNames[set]);
+			for(int i = 0; i < 4; ++i)
+			{
+				std::printf(" %7.2f", times[i]);
+				if( set == Scalar )
+					std::printf("      ");
+				else
+					std::printf(" %4.1fx", scalarTimes[i] / times[i]);
+			}
+			std::printf("%s\n", sink == 0 ? " " : "");
+		}
+	}
+
+	SetKernelSet(best);
+	return 0;
+}
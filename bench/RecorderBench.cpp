@@ -0,0 +1,91 @@
+//======================================================================================================
+//
+//	File:		RecorderBench.cpp
+//	Created:	Tuesday, 20 October 2026 15:37:48
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	Measures cost of ConsoleRecorder added to Write() of a VirtualConsole.
+//
+//	Usage: RecorderBench [log path] [writes]
+//
+//======================================================================================================
+
+#include "ConsoleRecorder.h"
+#include "VirtualConsole.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+using namespace WindowConsole;
+
+enum Mode
+{
+	Detached,
+	Synchronous,
+	BackgroundThread
+};
+
+static const char * const ModeNames[] = {"detached", "synchronous", "background"};
+
+// returns time of a single Write() in nanoseconds
+static double Run(Mode inMode, const std::string &inPath, int inWrites, long long &outLogSize)
+{
+	VirtualConsole console;
+	ConsoleRecorder recorder;
+	console.Create();
+
+	if( inMode != Detached )
+	{
+		COORD size = console.GetBufferSize();
+		recorder.Start(inPath, size.X, size.Y, inMode == BackgroundThread);
+		console.SetRecorder(&recorder);
+	}
+
+	// status screen: a row is rewritten with its value in one of a few colors
+	wchar_t line[64];
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for(int i = 0; i < inWrites; ++i)
+	{
+		std::swprintf(line, sizeof(line) / sizeof(line[0]), L"worker %2d: %8d requests", i % 40, i);
+		console.GotoXY(0, (short)(i % 40));
+		console.Write(line, (i % 7 == 0) ? ConsoleColor::Red : ConsoleColor::Green);
+	}
+	recorder.Stop();
+	double time = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / inWrites;
+
+	outLogSize = 0;
+	if( inMode != Detached )
+	{
+		std::ifstream file(inPath.c_str(), std::ios::binary | std::ios::ate);
+		outLogSize = (long long)file.tellg();
+	}
+	return time;
+}
+
+int main(int argc, char **argv)
+{
+	const std::string path = argc > 1 ? argv[1] : "RecorderBench.wcr";
+	const int writes = argc > 2 ? std::atoi(argv[2]) : 1000000;
+
+	std::printf("%d writes of a status line, each after GotoXY()\n", writes);
+	std::printf("%-12s %12s %10s %12s\n", "recorder", "ns/write", "overhead", "log bytes");
+
+	double detachedTime = 0;
+	for(int mode = Detached; mode <= BackgroundThread; ++mode)
+	{
+		long long logSize;
+		double time = Run((Mode)mode, path, writes, logSize);
+		if( mode == Detached )
+			detachedTime = time;
+		std::printf("%-12s %12.1f %9.1f%% %12lld\n", ModeNames[mode], time, (time / detachedTime - 1.0) * 100.0, logSize);
+	}
+
+	std::remove(path.c_str());
+	return 0;
+}
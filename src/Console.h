@@ -0,0 +1,394 @@
+//======================================================================================================
+//
+//	File:		Console.h
+//	Created:	Tuesday, 20 October 2026 16:48:20
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	Interface of the console, implemented by WindowsConsole and VirtualConsole.
+//
+//======================================================================================================
+
+#ifndef __CONSOLE_H__
+#define __CONSOLE_H__
+#pragma once
+
+#ifdef _WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#include <Windows.h>
+#endif
+
+#include <string>
+
+#include "ConsoleCanvas.h"
+
+namespace WindowConsole
+{
+#ifndef _WIN32
+	// without Windows only VirtualConsole can be used, the interface needs these names from Windows.h
+	typedef void * HWND;
+	struct COORD
+	{
+		short X;
+		short Y;
+	};
+
+	const unsigned short FOREGROUND_BLUE = 0x0001;
+	const unsigned short FOREGROUND_GREEN = 0x0002;
+	const unsigned short FOREGROUND_RED = 0x0004;
+	const unsigned short FOREGROUND_INTENSITY = 0x0008;
+#endif
+
+	class ConsoleRecorder;
+
+	enum ConsoleColor
+	{
+		Black = 0,
+		DarkBlue = FOREGROUND_BLUE,
+		DarkGreen = FOREGROUND_GREEN,
+		DarkAqua = FOREGROUND_GREEN | FOREGROUND_BLUE,
+		DarkRed = FOREGROUND_RED,
+		DarkPurple = FOREGROUND_BLUE | FOREGROUND_RED,
+		DarkYellow = FOREGROUND_GREEN | FOREGROUND_RED,
+		DarkWhite = FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE,
+		Grey = FOREGROUND_INTENSITY,
+		Blue = FOREGROUND_BLUE | FOREGROUND_INTENSITY,
+		Green = FOREGROUND_GREEN | FOREGROUND_INTENSITY,	
+		Aqua = FOREGROUND_GREEN | FOREGROUND_BLUE | FOREGROUND_INTENSITY,
+		Red = FOREGROUND_RED | FOREGROUND_INTENSITY,
+		Purple = FOREGROUND_BLUE | FOREGROUND_RED | FOREGROUND_INTENSITY,
+		Yellow = FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_INTENSITY,
+		White = FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE | FOREGROUND_INTENSITY,	
+		None = -1
+	}; 
+
+	/// <summary>
+	/// Console that applications write to and read from.
+	/// </summary>
+	/// <remarks>
+	/// WindowsConsole shows it in a console window, VirtualConsole keeps it in memory. Code written
+	///	against Console can be run by users and by load tests without changes.
+	///</remarks>
+	class Console
+	{
+	public:
+
+		/// <summary>
+		/// Destructor. Destroys object and cleans up.
+		/// </summary>
+		virtual ~Console() {  }
+
+
+		/// <summary>
+		/// Creates and sets up console. 
+		/// </summary>
+		virtual void Create() = 0;
+
+	
+		/// <summary>
+		/// Destroys console's object and cleans up. 
+		/// </summary>
+		virtual void Destroy() = 0;
+
+
+		/// <summary>
+		/// Sets new title. It is displayed in title bar of console window.
+		/// </summary>
+		/// <param>The tite to be displayed in title bar of console window.</param>
+		/// <returns> True when succeeded, otherwise false.</returns>
+		virtual bool SetCaption(const std::wstring &inCaption) = 0;
+
+
+		/// <summary>
+		/// Returns title of the current console window. 
+		/// </summary>
+		/// <returns> The string with title of the console window.</returns> 
+		virtual std::wstring GetCaption() = 0;
+
+
+		/// <summary>
+		/// Moves cursor to fixed position.
+		/// </summary>
+		/// <param>The X coordinate.</param>
+		/// <param>The Y coordinate.</param>
+		/// <remarks>
+		/// The X and Y coordinates are zero based. Position {X = 0, Y = 0} is in upper-left corner of the window.
+		///</remarks>
+		virtual void GotoXY(const short &inX, const short &inY) = 0;
+
+
+		/// <summary>
+		/// Hides cursor.
+		/// </summary>
+		/// <returns> True when succeeded, otherwise false.</returns>
+		virtual bool HideCursor() = 0;
+
+		/// <summary>
+		/// Shows cursor.
+		/// </summary>
+		/// <returns> True when succeeded, otherwise false.</returns>
+		virtual bool ShowCursor() = 0;
+
+
+		/// <summary>
+		/// Sets cursor's size.
+		/// </summary>
+		/// <param>New size of the cursor</param>
+		/// <returns> True when succeeded, otherwise false.</returns>
+		/// <remarks>
+		/// The cursor's size should be between 0 and 100. If it is greater than 100, size of the cursor will be cut to 100.
+		///</remarks>
+		virtual bool SetCursorSize(const char &inSize) = 0;
+
+
+		/// <summary>
+		/// Returns cursor's size.
+		/// </summary>
+		/// <returns>Size of the cursor. </return>
+		virtual char GetCursorSize() = 0;
+
+	
+		/// <summary>
+		/// Returns handle to console window.
+		/// </summary>
+		/// <returns>Handle to console window.</return>
+		virtual HWND GetWindowHandle() = 0;
+
+
+		/// <summary>
+		/// Shows console window on the screen..
+		/// </summary>
+		/// <returns> True when succeeded, otherwise false.</returns>
+		virtual bool ShowConsoleWindow() = 0;
+
+
+		/// <summary>
+		/// Hide console window.
+		/// </summary>
+		/// <returns> True when succeeded, otherwise false.</returns>
+		virtual bool HideConsoleWindow() = 0;
+
+		/// <summary>
+		/// Resizes console window.
+		/// </summary>
+		/// <param>New width of the console window in number of characters.</param>
+		/// <param>New height of the console window in number of characters.</param>
+		/// <returns>True when succeeded, otherwise false.</returns>
+		/// <remarks>
+		/// Size of the console window is limited and depends of user's screen resolution. You can 
+		///	resize window to specific size returned by GetlargestWindowSize(). If you  try to create
+		///	to big window method will not work and return false. 
+		///</remarks>
+		virtual bool SetWindowsSize(const short &inWidth, const short &inHeight) = 0;
+
+
+		/// <summary>
+		/// Returns console window size.
+		/// </summary>
+		/// <returns>Struct that contains width and height of the console window.</returns>
+		/// <remarks>
+		/// Returned value is specified in number of characters.
+		///</remarks>
+		virtual COORD GetWindowSize() = 0;
+
+
+		/// <summary>
+		/// Returns largest avalible console window size.
+		/// </summary>
+		/// <returns>Struct that contains largest avalible width and height of the console window.</returns>
+		virtual COORD GetLargestWindowSize() = 0;
+
+	
+		/// <summary>
+		/// Sets new background color of the console.
+		/// </summary>
+		/// <params>New color of the backround.</params>
+		virtual void SetBackgroudColor(ConsoleColor inBackgroundColor) = 0;
+
+	
+		/// <summary>
+		/// Sets new color of the input font.
+		/// </summary>
+		/// <params>New color of the input font.</params>
+		virtual void SetInputColor(ConsoleColor inInputColor) = 0;
+
+	
+		/// <summary>
+		/// Sets new color of the output font.
+		/// </summary>
+		/// <params>New color of the output font.</params>
+		virtual void SetOutputColor(ConsoleColor inOutputColor) = 0;
+
+
+		/// <summary>
+		/// Returns color of the backround.
+		/// </summary>
+		/// <returns>Color of the backround.</returns>
+		virtual ConsoleColor GetBackgroudColor() = 0;
+
+	
+		/// <summary>
+		/// Returns color of the input font.
+		/// </summary>
+		/// <returns>Color of the input font.</returns>
+		virtual ConsoleColor GetInputColor() = 0;
+
+
+		/// <summary>
+		/// Returns color of the output font.
+		/// </summary>
+		/// <returns>Color of the output font.</returns>
+		virtual ConsoleColor GetOutputColor() = 0;
+
+
+		/// <summary>
+		/// Write text on the console screen.
+		/// </summary>
+		/// <param>Text that will be displayed on the console screen.</param>
+		/// <param>Input font color only for this input string. If it is ommited then defualt color (or set by SetInputColor()) will be used. </param>
+		/// <param>Background color only for this input string. If it is ommited then defualt color (or set by SetInputColor()) will be used. </param>
+		/// <remarks>
+		/// Method starts writing at the last cursor position and leaves cursor at the position right 
+		///	behind the last character of the displated wstring.
+		///</remarks>
+		virtual void Write(const std::wstring &inText, ConsoleColor inOutputColor = ConsoleColor::None, ConsoleColor inBackgroundColor = ConsoleColor::None) = 0;
+	
+
+		/// <summary>
+		/// Write text on the console screen and move cursor to new line.
+		/// </summary>
+		/// <param>Text that will be displayed on the console screen.</param>
+		/// <param>Input font color only for this input string. If it is ommited then defualt color (or set by SetInputColor()) will be used. </param>
+		/// <param>Background color only for this input string. If it is ommited then defualt color (or set by SetInputColor()) will be used. </param>
+		/// <remarks>
+		/// Method starts writing at the last cursor position and move cursor to new line.
+		///</remarks>
+		virtual void Writeln(const std::wstring &inText, ConsoleColor inOutputColor = ConsoleColor::None, ConsoleColor inBackgroundColor = ConsoleColor::None) = 0;
+	
+	
+		/// <summary>
+		/// Clears console buffer.
+		/// </summary>
+		/// <param>The new background color of the console.</param>
+		/// <remarks>
+		/// If the inBackgroundColor is passed, then a new backgorund color is set. It works like SetBackgorunColor().
+		///</remarks>
+		virtual void Clear(ConsoleColor inBackgroundColor = ConsoleColor::None) = 0;
+
+	
+		/// <summary>
+		/// Clears line where is a cursor.
+		/// </summary>
+		virtual void Clearln() = 0;
+
+
+		/// <summary>
+		/// Resizes console buffer.
+		/// </summary>
+		/// <param>New width of the console buffer in number of characters.</param>
+		/// <param>New height of the console buffer in number of characters.</param>
+		/// <returns>True when succeeded, otherwise false.</returns>
+		/// <remarks>
+		/// Sometimes `SetBufferSize()` will also resize console window. This is necesary to resize buffer.
+		/// For example, that happens when you create buffer smaller than window.
+		///</remarks>
+		virtual bool SetBufferSize(const short &inWidth, const short &inHeight) = 0;
+
+
+		/// <summary>
+		/// Returns console buffer size.
+		/// </summary>
+		/// <returns>Struct that contains width and height of the console buffer.</returns>
+		/// <remarks>
+		/// Returned value is specified in number of characters.
+		///</remarks>
+		virtual COORD GetBufferSize() = 0;
+
+
+		/// <summary>
+		/// Reads characters from console input and save them in outBuffer.
+		/// </summary>
+		/// <param>Buffer that receives the characters from console input.</param>
+		/// <param>Input font color only for this input string. If it is ommited then defualt color (or set by SetInputColor()) will be used. </param>
+		/// <param>Background color only for this input string. If it is ommited then defualt color (or set by SetInputColor()) will be used. </param>
+		/// <remarks>
+		/// Number of characters read from input must be smaller than input buffer size. 
+		/// You can get input buffer size using GetInputBufferSize() and set it with SetInputBufferSize().
+		///</remarks>
+		virtual void Read(std::wstring &outBuffor, ConsoleColor inInputColor = ConsoleColor::None, ConsoleColor inBackgroundColor = ConsoleColor::None) = 0;
+
+
+		/// <summary>
+		/// Sets input buffer size.
+		/// </summary>
+		/// <param>Number of characters that console will be able to read from input.</param>
+		virtual void SetInputBufferSize(const short &inSize) = 0;
+
+
+		/// <summary>
+		/// Returns input buffer size.
+		/// </summary>
+		/// <returns>Number of character that can be read form input.</returns>
+		virtual short GetInputBufferSize() = 0;
+
+
+		/// <summary>
+		/// Returns code of the key that is down.
+		/// </summary>
+		/// <returns> Code of the key that is down..</returns>
+		virtual int ReadKey() = 0;
+
+
+		/// <summary>
+		/// Enables console echo.
+		/// </summary>
+		/// <remarks>
+		/// When echo is enabled then charcters sent from input are displayed on the screen.
+		///</remarks>
+		virtual void EnableEcho() = 0;
+
+
+		/// <summary>
+		/// Disables console echo.
+		/// </summary>
+		/// <remarks>
+		/// When echo is disabled then charcters sent from input are NOT displayed on the screen.
+		///</remarks>
+		virtual void DisableEcho() = 0;
+
+
+		/// <summary>
+		/// Displays canvas in the upper-left corner of the console buffer.
+		/// </summary>
+		/// <param>Canvas that will be displayed on the console screen.</param>
+		/// <remarks>
+		/// Canvas can be composed by many threads (see ConsoleCanvas::Compose()), but Present() must be
+		///	called from one thread. Parts of the canvas that do not fit into the buffer are skipped.
+		///</remarks>
+		virtual void Present(const ConsoleCanvas &inCanvas) = 0;
+
+
+		/// <summary>
+		/// Sets recorder that receives everything written to and read from the console.
+		/// </summary>
+		/// <param>Recorder, or NULL to stop sending events.</param>
+		/// <remarks>
+		/// Console does not own the recorder. Recording is started and stopped with ConsoleRecorder::Start()
+		///	and ConsoleRecorder::Stop(), logs are replayed with ConsolePlayer. If the recorder is started,
+		///	then colors, cursor position and buffer of the console are recorded first, so the log can
+		///	be replayed even if the recording starts in the middle of the session.
+		///</remarks>
+		virtual void SetRecorder(ConsoleRecorder *inRecorder) = 0;
+
+
+		/// <summary>
+		/// Returns recorder set with SetRecorder().
+		/// </summary>
+		virtual ConsoleRecorder * GetRecorder() = 0;
+	};
+
+}
+
+#endif
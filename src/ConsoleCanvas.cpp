@@ -0,0 +1,220 @@
+//======================================================================================================
+//
+//	File:		ConsoleCanvas.cpp
+//	Created:	Monday, 19 October 2026 10:12:31
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	Off-screen grid of console cells that can be composed by many threads at once.
+//
+//======================================================================================================
+
+#include "ConsoleCanvas.h"
+#include "ConsoleCellWidth.h"
+#include "ConsoleKernels.h"
+#include "ConsoleThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+using namespace WindowConsole;
+
+// dark white text on black background, the same as new console
+static const unsigned short DefaultAttribute = 0x07;
+
+ConsoleCanvas::ConsoleCanvas(): mWidth(0), mHeight(0)
+{  }
+
+ConsoleCanvas::ConsoleCanvas(const short &inWidth, const short &inHeight): mWidth(0), mHeight(0)
+{
+	Resize(inWidth, inHeight);
+}
+
+ConsoleCanvas::~ConsoleCanvas()
+{  }
+
+void ConsoleCanvas::Resize(const short &inWidth, const short &inHeight)
+{
+	mWidth = std::max<short>(inWidth, 0);
+	mHeight = std::max<short>(inHeight, 0);
+	mCharacters.assign(mWidth * mHeight, L' ');
+	mAttributes.assign(mWidth * mHeight, DefaultAttribute);
+}
+
+short ConsoleCanvas::GetWidth() const
+{
+	return mWidth;
+}
+
+short ConsoleCanvas::GetHeight() const
+{
+	return mHeight;
+}
+
+wchar_t * ConsoleCanvas::GetCharacters()
+{
+	return mCharacters.data();
+}
+
+const wchar_t * ConsoleCanvas::GetCharacters() const
+{
+	return mCharacters.data();
+}
+
+unsigned short * ConsoleCanvas::GetAttributes()
+{
+	return mAttributes.data();
+}
+
+const unsigned short * ConsoleCanvas::GetAttributes() const
+{
+	return mAttributes.data();
+}
+
+wchar_t * ConsoleCanvas::GetRowCharacters(const short &inY)
+{
+	return mCharacters.data() + inY * mWidth;
+}
+
+const wchar_t * ConsoleCanvas::GetRowCharacters(const short &inY) const
+{
+	return mCharacters.data() + inY * mWidth;
+}
+
+unsigned short * ConsoleCanvas::GetRowAttributes(const short &inY)
+{
+	return mAttributes.data() + inY * mWidth;
+}
+
+const unsigned short * ConsoleCanvas::GetRowAttributes(const short &inY) const
+{
+	return mAttributes.data() + inY * mWidth;
+}
+
+void ConsoleCanvas::SetCell(const short &inX, const short &inY, wchar_t inCharacter, unsigned short inAttribute)
+{
+	if( (inX < 0) || (inX >= mWidth) || (inY < 0) || (inY >= mHeight) )
+		return;
+
+	mCharacters[inY * mWidth + inX] = inCharacter;
+	mAttributes[inY * mWidth + inX] = inAttribute;
+}
+
+void ConsoleCanvas::SetCluster(const short &inX, const short &inY, const wchar_t *inCluster, size_t inLength, int inWidth, unsigned short inAttribute)
+{
+	if( (inWidth == 0) || (inLength == 0) || (inX < 0) || (inX + inWidth > mWidth) || (inY < 0) || (inY >= mHeight) )
+		return;
+
+	wchar_t *characters = GetRowCharacters(inY);
+	unsigned short *attributes = GetRowAttributes(inY);
+	const unsigned short cellFlags = LeadingCellFlag | TrailingCellFlag;
+
+	// halves of the wide characters that are overwritten only partly
+	if( (attributes[inX] & TrailingCellFlag) && (inX > 0) )
+	{
+		characters[inX - 1] = L' ';
+		attributes[inX - 1] &= ~cellFlags;
+	}
+	if( (attributes[inX + inWidth - 1] & LeadingCellFlag) && (inX + inWidth < mWidth) )
+	{
+		characters[inX + inWidth] = L' ';
+		attributes[inX + inWidth] &= ~cellFlags;
+	}
+
+	wchar_t first = ComposeCluster(inCluster, inLength);
+	bool isSurrogatePair = (sizeof(wchar_t) == 2) && (inLength > 1) && (first >= 0xD800) && (first <= 0xDBFF);
+
+	inAttribute &= ~cellFlags;
+	if( inWidth == 1 )
+	{
+		// one cell cannot keep a character outside BMP
+		characters[inX] = isSurrogatePair ? (wchar_t)0xFFFD : first;
+		attributes[inX] = inAttribute;
+	}
+	else
+	{
+		characters[inX] = first;
+		attributes[inX] = inAttribute | LeadingCellFlag;
+		characters[inX + 1] = isSurrogatePair ? inCluster[1] : first;
+		attributes[inX + 1] = inAttribute | TrailingCellFlag;
+	}
+}
+
+short ConsoleCanvas::WriteText(const short &inX, const short &inY, const std::wstring &inText, unsigned short inAttribute)
+{
+	const wchar_t *text = inText.data();
+	size_t length = inText.length();
+	short x = inX;
+
+	while( length > 0 )
+	{
+		int width;
+		size_t units = GetCluster(text, length, width);
+		if( x + width > mWidth )
+			break;
+
+		SetCluster(x, inY, text, units, width, inAttribute);
+		x = (short)(x + width);
+		text += units;
+		length -= units;
+	}
+	return (short)(x - inX);
+}
+
+void ConsoleCanvas::Fill(wchar_t inCharacter, unsigned short inAttribute)
+{
+	FillCharacters(mCharacters.data(), inCharacter, mCharacters.size());
+	FillAttributes(mAttributes.data(), inAttribute, mAttributes.size());
+}
+
+void ConsoleCanvas::Compose(const ComposeFunction &inFunction, short inBandHeight, unsigned inThreadCount)
+{
+	if( mHeight == 0 )
+		return;
+
+	if( inBandHeight < 1 )
+		inBandHeight = 1;
+
+	const int bandCount = (mHeight + inBandHeight - 1) / inBandHeight;
+
+	if( inThreadCount == 0 )
+		inThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+	inThreadCount = std::min<unsigned>(inThreadCount, bandCount);
+
+	// index of the next band that is not taken by any thread yet
+	std::atomic<int> nextBand(0);
+	std::exception_ptr error;
+	std::mutex errorMutex;
+
+	std::function<void()> worker = [&]()
+	{
+		try
+		{
+			for(int band = nextBand++; band < bandCount; band = nextBand++)
+			{
+				short firstRow = (short)(band * inBandHeight);
+				short lastRow = (short)std::min<int>(firstRow + inBandHeight, mHeight);
+				inFunction(*this, firstRow, lastRow);
+			}
+		}
+		catch(...)
+		{
+			// other threads finish their bands and do not take new ones
+			nextBand = bandCount;
+			std::lock_guard<std::mutex> lock(errorMutex);
+			if( !error )
+				error = std::current_exception();
+		}
+	};
+
+	// calling thread renders bands too, the others are taken from the shared pool
+	ConsoleThreadPool::GetInstance().Run(worker, inThreadCount);
+
+	if( error )
+		std::rethrow_exception(error);
+}
@@ -0,0 +1,186 @@
+//======================================================================================================
+//
+//	File:		ConsoleCanvas.h
+//	Created:	Monday, 19 October 2026 10:12:31
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	Off-screen grid of console cells that can be composed by many threads at once.
+//
+//======================================================================================================
+
+#ifndef __CONSOLECANVAS_H__
+#define __CONSOLECANVAS_H__
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace WindowConsole
+{
+	class ConsoleCanvas
+	{
+	public:
+
+		/// <summary>
+		/// Function that renders rows [inFirstRow, inLastRow) of the canvas.
+		/// </summary>
+		typedef std::function<void(ConsoleCanvas &ioCanvas, short inFirstRow, short inLastRow)> ComposeFunction;
+
+
+		/// <summary>
+		/// Constructor. Creates empty canvas.
+		/// </summary>
+		ConsoleCanvas();
+
+
+		/// <summary>
+		/// Constructor. Creates canvas filled with spaces.
+		/// </summary>
+		/// <param>Width of the canvas in number of characters.</param>
+		/// <param>Height of the canvas in number of characters.</param>
+		ConsoleCanvas(const short &inWidth, const short &inHeight);
+
+
+		/// <summary>
+		/// Destructor. Destroys object and cleans up.
+		/// </summary>
+		~ConsoleCanvas();
+
+
+		/// <summary>
+		/// Resizes canvas. Content of the canvas is lost.
+		/// </summary>
+		/// <param>New width of the canvas in number of characters.</param>
+		/// <param>New height of the canvas in number of characters.</param>
+		void Resize(const short &inWidth, const short &inHeight);
+
+
+		/// <summary>
+		/// Returns width of the canvas in number of characters.
+		/// </summary>
+		short GetWidth() const;
+
+
+		/// <summary>
+		/// Returns height of the canvas in number of characters.
+		/// </summary>
+		short GetHeight() const;
+
+
+		/// <summary>
+		/// Returns characters of all cells, stored row by row.
+		/// </summary>
+		/// <remarks>
+		/// Characters and attributes are kept in two separate arrays, so the same layout can be passed
+		///	directly to WriteConsoleOutputCharacter() and WriteConsoleOutputAttribute().
+		///</remarks>
+		wchar_t * GetCharacters();
+		const wchar_t * GetCharacters() const;
+
+
+		/// <summary>
+		/// Returns attributes of all cells, stored row by row.
+		/// </summary>
+		unsigned short * GetAttributes();
+		const unsigned short * GetAttributes() const;
+
+
+		/// <summary>
+		/// Returns characters of the single row.
+		/// </summary>
+		/// <param>The Y coordinate of the row.</param>
+		wchar_t * GetRowCharacters(const short &inY);
+		const wchar_t * GetRowCharacters(const short &inY) const;
+
+
+		/// <summary>
+		/// Returns attributes of the single row.
+		/// </summary>
+		/// <param>The Y coordinate of the row.</param>
+		unsigned short * GetRowAttributes(const short &inY);
+		const unsigned short * GetRowAttributes(const short &inY) const;
+
+
+		/// <summary>
+		/// Sets character and attribute of the single cell.
+		/// </summary>
+		/// <param>The X coordinate.</param>
+		/// <param>The Y coordinate.</param>
+		/// <param>New character of the cell.</param>
+		/// <param>New attribute of the cell.</param>
+		/// <remarks>
+		/// Cells outside of the canvas are ignored.
+		///</remarks>
+		void SetCell(const short &inX, const short &inY, wchar_t inCharacter, unsigned short inAttribute);
+
+
+		/// <summary>
+		/// Writes a grapheme cluster to the cells starting at the given one.
+		/// </summary>
+		/// <param>The X coordinate.</param>
+		/// <param>The Y coordinate.</param>
+		/// <param>Cluster found with GetCluster().</param>
+		/// <param>Length of the cluster in wchar_t.</param>
+		/// <param>Width of the cluster returned by GetCluster().</param>
+		/// <param>Attribute of the cells.</param>
+		/// <remarks>
+		/// Cluster of width 2 takes two cells marked with LeadingCellFlag and TrailingCellFlag, clusters
+		///	of width 0 are skipped. Cell keeps the character returned by ComposeCluster(), so marks
+		///	without a precomposed form are lost. Wide character that is partly overwritten is replaced
+		///	with spaces. Cells outside of the canvas are ignored.
+		///</remarks>
+		void SetCluster(const short &inX, const short &inY, const wchar_t *inCluster, size_t inLength, int inWidth, unsigned short inAttribute);
+
+
+		/// <summary>
+		/// Writes text to the row, starting at the given cell.
+		/// </summary>
+		/// <param>The X coordinate of the first cell.</param>
+		/// <param>The Y coordinate of the row.</param>
+		/// <param>Text that will be written. Control characters are skipped.</param>
+		/// <param>Attribute of the cells.</param>
+		/// <returns>Number of cells taken by the written text.</returns>
+		/// <remarks>
+		/// Text is split into grapheme clusters, so wide characters take two cells and combining
+		///	marks none (see ConsoleCellWidth.h). Text that does not fit into the row is cut.
+		///</remarks>
+		short WriteText(const short &inX, const short &inY, const std::wstring &inText, unsigned short inAttribute);
+
+
+		/// <summary>
+		/// Fills whole canvas with character and attribute.
+		/// </summary>
+		/// <param>Character that is written to every cell.</param>
+		/// <param>Attribute that is written to every cell.</param>
+		void Fill(wchar_t inCharacter, unsigned short inAttribute);
+
+
+		/// <summary>
+		/// Renders canvas using many threads.
+		/// </summary>
+		/// <param>Function that renders a band of rows.</param>
+		/// <param>Number of rows in a single band.</param>
+		/// <param>Number of threads. If it is 0, then number of hardware threads is used.</param>
+		/// <remarks>
+		/// Canvas is split into bands of inBandHeight rows. Every thread takes the next free band
+		///	as soon as it finishes the previous one, so slow bands do not stall the others.
+		///	Bands never overlap, so inFunction may write to its rows without locking.
+		///	Threads are taken from ConsoleThreadPool and stay alive between calls. Method returns
+		///	when all bands are rendered. If inFunction throws, then no new bands are started and the
+		///	first exception is rethrown after all threads return.
+		///</remarks>
+		void Compose(const ComposeFunction &inFunction, short inBandHeight = 8, unsigned inThreadCount = 0);
+
+	protected:
+		short mWidth, mHeight;
+		std::vector<wchar_t> mCharacters;
+		std::vector<unsigned short> mAttributes;
+	};
+
+}
+
+#endif
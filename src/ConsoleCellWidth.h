@@ -0,0 +1,85 @@
+//======================================================================================================
+//
+//	File:		ConsoleCellWidth.h
+//	Created:	Monday, 19 October 2026 23:15:09
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	Number of console cells taken by characters and grapheme clusters.
+//
+//======================================================================================================
+
+#ifndef __CONSOLECELLWIDTH_H__
+#define __CONSOLECELLWIDTH_H__
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace WindowConsole
+{
+	/// <summary>
+	/// Attribute flags of the two cells taken by a wide character, the same as COMMON_LVB_LEADING_BYTE
+	///	and COMMON_LVB_TRAILING_BYTE.
+	/// </summary>
+	/// <remarks>
+	/// Trailing cell of a BMP character contains the same character. Trailing cell of a character
+	///	outside BMP contains its low surrogate, and the leading cell its high surrogate.
+	///</remarks>
+	const unsigned short LeadingCellFlag = 0x0100;
+	const unsigned short TrailingCellFlag = 0x0200;
+
+
+	/// <summary>
+	/// Returns number of cells taken by a single code point.
+	/// </summary>
+	/// <param>Unicode code point.</param>
+	/// <returns>2 for East Asian wide and fullwidth characters and emoji, 0 for combining marks,
+	///	format and control characters, otherwise 1.</returns>
+	/// <remarks>
+	/// ASCII and BMP are looked up in a table. Characters outside BMP are searched, and widths of
+	///	the recently seen ones are cached per thread, as emoji clusters repeat them.
+	///</remarks>
+	int GetCharacterWidth(unsigned int inCodePoint);
+
+
+	/// <summary>
+	/// Finds the first grapheme cluster of the text.
+	/// </summary>
+	/// <param>Text, UTF-16 when wchar_t has 16 bits, otherwise UTF-32.</param>
+	/// <param>Length of the text in wchar_t.</param>
+	/// <param>Receives number of cells taken by the cluster.</param>
+	/// <returns>Length of the cluster in wchar_t, 0 if inLength is 0.</returns>
+	/// <remarks>
+	/// Cluster is a base character followed by combining marks, variation selectors and characters
+	///	joined with ZERO WIDTH JOINER, or a pair of regional indicators (flag). Width of the cluster is
+	///	the width of its base, 2 for flags and for bases followed by VARIATION SELECTOR-16. Clusters
+	///	of more code points seen recently are cached per thread, as emoji sequences repeat in text.
+	///</remarks>
+	size_t GetCluster(const wchar_t *inText, size_t inLength, int &outWidth);
+
+
+	/// <summary>
+	/// Returns number of cells taken by the text.
+	/// </summary>
+	int GetTextWidth(const std::wstring &inText);
+
+
+	/// <summary>
+	/// Returns the character that is kept in a console cell for a grapheme cluster.
+	/// </summary>
+	/// <param>Cluster found with GetCluster().</param>
+	/// <param>Length of the cluster in wchar_t.</param>
+	/// <returns>Base character of the cluster composed with its combining marks.</returns>
+	/// <remarks>
+	/// Console cell keeps one character, so marks are composed where Unicode has a precomposed BMP
+	///	character (e.g. e and U+0301 give U+00E9), and Hangul jamo are composed into syllables. Other
+	///	marks, variation selectors and characters joined with ZWJ are lost. Base outside BMP is not
+	///	composed, its high surrogate is returned when wchar_t has 16 bits.
+	///</remarks>
+	wchar_t ComposeCluster(const wchar_t *inCluster, size_t inLength);
+}
+
+#endif
@@ -0,0 +1,358 @@
+//======================================================================================================
+//
+//	File:		ConsoleKernels.cpp
+//	Created:	Monday, 19 October 2026 14:40:05
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	Vectorised operations on arrays of console cells.
+//
+//======================================================================================================
+
+#include "ConsoleKernels.h"
+
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define CONSOLE_KERNELS_X86
+	#include <immintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+		// MSVC compiles AVX2 intrinsics without /arch:AVX2
+		#define CONSOLE_TARGET_AVX2
+	#else
+		#define CONSOLE_TARGET_AVX2 __attribute__((target("avx2")))
+	#endif
+#endif
+
+using namespace WindowConsole;
+
+// font color and LeadingCellFlag / TrailingCellFlag of wide characters
+static const unsigned short KeptAttributeBits = 0x030F;
+
+//------------------------------------------------------------------------------------------------------
+//	Scalar kernels
+//------------------------------------------------------------------------------------------------------
+
+static void FillCharactersScalar(wchar_t *outCharacters, wchar_t inCharacter, size_t inCount)
+{
+	for(size_t i = 0; i < inCount; ++i)
+		outCharacters[i] = inCharacter;
+}
+
+static void FillAttributesScalar(unsigned short *outAttributes, unsigned short inAttribute, size_t inCount)
+{
+	for(size_t i = 0; i < inCount; ++i)
+		outAttributes[i] = inAttribute;
+}
+
+static void RemapBackgroundScalar(unsigned short *ioAttributes, unsigned short inBackgroundColor, size_t inCount)
+{
+	for(size_t i = 0; i < inCount; ++i)
+		ioAttributes[i] = ( ( (inBackgroundColor & 0x0F) << 4) + (ioAttributes[i] & KeptAttributeBits) );
+}
+
+// returns index of the first cell, starting at inStart, that is equal (inIsEqual) or changed (!inIsEqual)
+static size_t FindCellScalar(const wchar_t *inCharacters, const unsigned short *inAttributes,
+	const wchar_t *inOldCharacters, const unsigned short *inOldAttributes,
+	size_t inCount, size_t inStart, bool inIsEqual)
+{
+	for(size_t i = inStart; i < inCount; ++i)
+	{
+		bool isEqual = (inCharacters[i] == inOldCharacters[i]) && (inAttributes[i] == inOldAttributes[i]);
+		if( isEqual == inIsEqual )
+			return i;
+	}
+	return inCount;
+}
+
+#ifdef CONSOLE_KERNELS_X86
+
+static unsigned CountTrailingZeros(unsigned inMask)
+{
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward(&index, inMask);
+	return index;
+#else
+	return __builtin_ctz(inMask);
+#endif
+}
+
+//------------------------------------------------------------------------------------------------------
+//	SSE2 kernels
+//------------------------------------------------------------------------------------------------------
+
+template<typename T>
+static __m128i Broadcast128(T inValue)
+{
+	if( sizeof(T) == 2 )
+		return _mm_set1_epi16((short)inValue);
+	return _mm_set1_epi32((int)inValue);
+}
+
+template<typename T>
+static void FillSSE2(T *outValues, T inValue, size_t inCount)
+{
+	const size_t step = sizeof(__m128i) / sizeof(T);
+	const __m128i value = Broadcast128(inValue);
+	size_t i = 0;
+	for(; i + step <= inCount; i += step)
+		_mm_storeu_si128((__m128i *)(outValues + i), value);
+	for(; i < inCount; ++i)
+		outValues[i] = inValue;
+}
+
+static void FillCharactersSSE2(wchar_t *outCharacters, wchar_t inCharacter, size_t inCount)
+{
+	FillSSE2(outCharacters, inCharacter, inCount);
+}
+
+static void FillAttributesSSE2(unsigned short *outAttributes, unsigned short inAttribute, size_t inCount)
+{
+	FillSSE2(outAttributes, inAttribute, inCount);
+}
+
+static void RemapBackgroundSSE2(unsigned short *ioAttributes, unsigned short inBackgroundColor, size_t inCount)
+{
+	const __m128i fontMask = _mm_set1_epi16(KeptAttributeBits);
+	const __m128i background = _mm_set1_epi16((short)( (inBackgroundColor & 0x0F) << 4));
+	size_t i = 0;
+	for(; i + 8 <= inCount; i += 8)
+	{
+		__m128i attributes = _mm_loadu_si128((const __m128i *)(ioAttributes + i));
+		attributes = _mm_or_si128(_mm_and_si128(attributes, fontMask), background);
+		_mm_storeu_si128((__m128i *)(ioAttributes + i), attributes);
+	}
+	RemapBackgroundScalar(ioAttributes + i, inBackgroundColor, inCount - i);
+}
+
+// returns eight 16-bit lanes, all ones when the character is equal, the same layout as compared attributes
+static __m128i CompareCharactersSSE2(const wchar_t *inCharacters, const wchar_t *inOldCharacters)
+{
+	if( sizeof(wchar_t) == 2 )
+	{
+		return _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *)inCharacters), _mm_loadu_si128((const __m128i *)inOldCharacters));
+	}
+
+	// wchar_t has 32 bits (Linux), lanes are 0 or -1, so the saturating pack keeps them
+	__m128i low = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)inCharacters), _mm_loadu_si128((const __m128i *)inOldCharacters));
+	__m128i high = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(inCharacters + 4)), _mm_loadu_si128((const __m128i *)(inOldCharacters + 4)));
+	return _mm_packs_epi32(low, high);
+}
+
+static size_t FindCellSSE2(const wchar_t *inCharacters, const unsigned short *inAttributes,
+	const wchar_t *inOldCharacters, const unsigned short *inOldAttributes,
+	size_t inCount, size_t inStart, bool inIsEqual)
+{
+	size_t i = inStart;
+	for(; i + 8 <= inCount; i += 8)
+	{
+		__m128i characters = CompareCharactersSSE2(inCharacters + i, inOldCharacters + i);
+		__m128i attributes = _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *)(inAttributes + i)),
+			_mm_loadu_si128((const __m128i *)(inOldAttributes + i)));
+
+		// two bits per cell, set when the cell is equal
+		unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(characters, attributes));
+		if( !inIsEqual )
+			mask = ~mask & 0xFFFF;
+		if( mask )
+			return i + CountTrailingZeros(mask) / 2;
+	}
+	return FindCellScalar(inCharacters, inAttributes, inOldCharacters, inOldAttributes, inCount, i, inIsEqual);
+}
+
+//------------------------------------------------------------------------------------------------------
+//	AVX2 kernels
+//------------------------------------------------------------------------------------------------------
+
+template<typename T>
+CONSOLE_TARGET_AVX2 static void FillAVX2(T *outValues, T inValue, size_t inCount)
+{
+	const size_t step = sizeof(__m256i) / sizeof(T);
+	const __m256i value = (sizeof(T) == 2) ? _mm256_set1_epi16((short)inValue) : _mm256_set1_epi32((int)inValue);
+	size_t i = 0;
+	for(; i + step <= inCount; i += step)
+		_mm256_storeu_si256((__m256i *)(outValues + i), value);
+	for(; i < inCount; ++i)
+		outValues[i] = inValue;
+}
+
+CONSOLE_TARGET_AVX2 static void FillCharactersAVX2(wchar_t *outCharacters, wchar_t inCharacter, size_t inCount)
+{
+	FillAVX2(outCharacters, inCharacter, inCount);
+}
+
+CONSOLE_TARGET_AVX2 static void FillAttributesAVX2(unsigned short *outAttributes, unsigned short inAttribute, size_t inCount)
+{
+	FillAVX2(outAttributes, inAttribute, inCount);
+}
+
+CONSOLE_TARGET_AVX2 static void RemapBackgroundAVX2(unsigned short *ioAttributes, unsigned short inBackgroundColor, size_t inCount)
+{
+	const __m256i fontMask = _mm256_set1_epi16(KeptAttributeBits);
+	const __m256i background = _mm256_set1_epi16((short)( (inBackgroundColor & 0x0F) << 4));
+	size_t i = 0;
+	for(; i + 16 <= inCount; i += 16)
+	{
+		__m256i attributes = _mm256_loadu_si256((const __m256i *)(ioAttributes + i));
+		attributes = _mm256_or_si256(_mm256_and_si256(attributes, fontMask), background);
+		_mm256_storeu_si256((__m256i *)(ioAttributes + i), attributes);
+	}
+	RemapBackgroundScalar(ioAttributes + i, inBackgroundColor, inCount - i);
+}
+
+// returns sixteen 16-bit lanes, all ones when the character is equal, the same layout as compared attributes
+CONSOLE_TARGET_AVX2 static __m256i CompareCharactersAVX2(const wchar_t *inCharacters, const wchar_t *inOldCharacters)
+{
+	if( sizeof(wchar_t) == 2 )
+	{
+		return _mm256_cmpeq_epi16(_mm256_loadu_si256((const __m256i *)inCharacters), _mm256_loadu_si256((const __m256i *)inOldCharacters));
+	}
+
+	// pack works within 128-bit halves, so the 64-bit quarters are put back in order
+	__m256i low = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)inCharacters), _mm256_loadu_si256((const __m256i *)inOldCharacters));
+	__m256i high = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(inCharacters + 8)), _mm256_loadu_si256((const __m256i *)(inOldCharacters + 8)));
+	return _mm256_permute4x64_epi64(_mm256_packs_epi32(low, high), _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+CONSOLE_TARGET_AVX2 static size_t FindCellAVX2(const wchar_t *inCharacters, const unsigned short *inAttributes,
+	const wchar_t *inOldCharacters, const unsigned short *inOldAttributes,
+	size_t inCount, size_t inStart, bool inIsEqual)
+{
+	size_t i = inStart;
+	for(; i + 16 <= inCount; i += 16)
+	{
+		__m256i characters = CompareCharactersAVX2(inCharacters + i, inOldCharacters + i);
+		__m256i attributes = _mm256_cmpeq_epi16(_mm256_loadu_si256((const __m256i *)(inAttributes + i)),
+			_mm256_loadu_si256((const __m256i *)(inOldAttributes + i)));
+
+		// two bits per cell, set when the cell is equal
+		unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_and_si256(characters, attributes));
+		if( !inIsEqual )
+			mask = ~mask;
+		if( mask )
+			return i + CountTrailingZeros(mask) / 2;
+	}
+	return FindCellSSE2(inCharacters, inAttributes, inOldCharacters, inOldAttributes, inCount, i, inIsEqual);
+}
+
+static bool IsAVX2Supported()
+{
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if( info[0] < 7 )
+		return false;
+
+	// OSXSAVE and AVX, then operating system must save YMM registers
+	__cpuid(info, 1);
+	if( ( (info[2] & (1 << 27)) == 0 ) || ( (info[2] & (1 << 28)) == 0 ) )
+		return false;
+	if( (_xgetbv(0) & 0x06) != 0x06 )
+		return false;
+
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+#endif
+
+//------------------------------------------------------------------------------------------------------
+//	Dispatch
+//------------------------------------------------------------------------------------------------------
+
+struct Kernels
+{
+	KernelSet set;
+	void (*fillCharacters)(wchar_t *, wchar_t, size_t);
+	void (*fillAttributes)(unsigned short *, unsigned short, size_t);
+	void (*remapBackground)(unsigned short *, unsigned short, size_t);
+	size_t (*findCell)(const wchar_t *, const unsigned short *, const wchar_t *, const unsigned short *, size_t, size_t, bool);
+};
+
+static KernelSet GetSupportedKernelSet()
+{
+#ifdef CONSOLE_KERNELS_X86
+	// SSE2 is part of every x86-64 processor and of every x86 processor that runs Windows 8 or newer
+	if( IsAVX2Supported() )
+		return KernelSet::AVX2;
+	return KernelSet::SSE2;
+#else
+	return KernelSet::Scalar;
+#endif
+}
+
+static Kernels CreateKernels(KernelSet inKernelSet)
+{
+	Kernels kernels = {KernelSet::Scalar, FillCharactersScalar, FillAttributesScalar, RemapBackgroundScalar, FindCellScalar};
+
+#ifdef CONSOLE_KERNELS_X86
+	if( inKernelSet >= KernelSet::SSE2 )
+	{
+		kernels.set = KernelSet::SSE2;
+		kernels.fillCharacters = FillCharactersSSE2;
+		kernels.fillAttributes = FillAttributesSSE2;
+		kernels.remapBackground = RemapBackgroundSSE2;
+		kernels.findCell = FindCellSSE2;
+	}
+	if( inKernelSet >= KernelSet::AVX2 )
+	{
+		kernels.set = KernelSet::AVX2;
+		kernels.fillCharacters = FillCharactersAVX2;
+		kernels.fillAttributes = FillAttributesAVX2;
+		kernels.remapBackground = RemapBackgroundAVX2;
+		kernels.findCell = FindCellAVX2;
+	}
+#endif
+
+	return kernels;
+}
+
+static Kernels & GetKernels()
+{
+	static Kernels kernels = CreateKernels(GetSupportedKernelSet());
+	return kernels;
+}
+
+KernelSet WindowConsole::GetKernelSet()
+{
+	return GetKernels().set;
+}
+
+KernelSet WindowConsole::SetKernelSet(KernelSet inKernelSet)
+{
+	GetKernels() = CreateKernels(std::min(inKernelSet, GetSupportedKernelSet()));
+	return GetKernels().set;
+}
+
+void WindowConsole::FillCharacters(wchar_t *outCharacters, wchar_t inCharacter, size_t inCount)
+{
+	GetKernels().fillCharacters(outCharacters, inCharacter, inCount);
+}
+
+void WindowConsole::FillAttributes(unsigned short *outAttributes, unsigned short inAttribute, size_t inCount)
+{
+	GetKernels().fillAttributes(outAttributes, inAttribute, inCount);
+}
+
+void WindowConsole::RemapBackground(unsigned short *ioAttributes, unsigned short inBackgroundColor, size_t inCount)
+{
+	GetKernels().remapBackground(ioAttributes, inBackgroundColor, inCount);
+}
+
+size_t WindowConsole::FindChangedRun(const wchar_t *inCharacters, const unsigned short *inAttributes,
+	const wchar_t *inOldCharacters, const unsigned short *inOldAttributes,
+	size_t inCount, size_t inStart, size_t &outLength)
+{
+	const Kernels &kernels = GetKernels();
+	size_t first = kernels.findCell(inCharacters, inAttributes, inOldCharacters, inOldAttributes, inCount, inStart, false);
+	size_t last = kernels.findCell(inCharacters, inAttributes, inOldCharacters, inOldAttributes, inCount, first, true);
+	outLength = last - first;
+	return first;
+}
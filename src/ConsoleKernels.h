@@ -0,0 +1,94 @@
+//======================================================================================================
+//
+//	File:		ConsoleKernels.h
+//	Created:	Monday, 19 October 2026 14:40:05
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	Vectorised operations on arrays of console cells.
+//
+//======================================================================================================
+
+#ifndef __CONSOLEKERNELS_H__
+#define __CONSOLEKERNELS_H__
+#pragma once
+
+#include <cstddef>
+
+namespace WindowConsole
+{
+	enum KernelSet
+	{
+		Scalar = 0,
+		SSE2 = 1,
+		AVX2 = 2
+	};
+
+
+	/// <summary>
+	/// Returns instruction set used by the kernels.
+	/// </summary>
+	/// <returns>The best instruction set supported by the processor, unless changed with SetKernelSet().</returns>
+	KernelSet GetKernelSet();
+
+
+	/// <summary>
+	/// Selects instruction set used by the kernels.
+	/// </summary>
+	/// <param>Requested instruction set.</param>
+	/// <returns>Instruction set that is used from now on.</returns>
+	/// <remarks>
+	/// If the processor does not support inKernelSet, then the best supported one below it is used.
+	///	Method is not thread safe and should be called only when no kernel is running, e.g. to compare
+	///	scalar and vector kernels.
+	///</remarks>
+	KernelSet SetKernelSet(KernelSet inKernelSet);
+
+
+	/// <summary>
+	/// Fills inCount characters with inCharacter.
+	/// </summary>
+	void FillCharacters(wchar_t *outCharacters, wchar_t inCharacter, size_t inCount);
+
+
+	/// <summary>
+	/// Fills inCount attributes with inAttribute.
+	/// </summary>
+	void FillAttributes(unsigned short *outAttributes, unsigned short inAttribute, size_t inCount);
+
+
+	/// <summary>
+	/// Replaces background color of inCount attributes, leaving their font color.
+	/// </summary>
+	/// <param>Attributes to change.</param>
+	/// <param>New background color, the same as ConsoleColor.</param>
+	/// <param>Number of attributes.</param>
+	/// <remarks>
+	/// Every attribute becomes ((inBackgroundColor & 0x0F) << 4) + (attribute & 0x030F), so cells of
+	///	wide characters keep LeadingCellFlag and TrailingCellFlag (see ConsoleCellWidth.h).
+	///</remarks>
+	void RemapBackground(unsigned short *ioAttributes, unsigned short inBackgroundColor, size_t inCount);
+
+
+	/// <summary>
+	/// Finds the next run of cells that differ between two frames.
+	/// </summary>
+	/// <param>Characters of the new frame.</param>
+	/// <param>Attributes of the new frame.</param>
+	/// <param>Characters of the old frame.</param>
+	/// <param>Attributes of the old frame.</param>
+	/// <param>Number of cells in both frames.</param>
+	/// <param>Index of the first cell to check.</param>
+	/// <param>Receives number of changed cells in the run.</param>
+	/// <returns>Index of the first changed cell, or inCount (with outLength = 0) when nothing changed.</returns>
+	/// <remarks>
+	/// Cell is changed when its character or attribute is different.
+	///</remarks>
+	size_t FindChangedRun(const wchar_t *inCharacters, const unsigned short *inAttributes,
+		const wchar_t *inOldCharacters, const unsigned short *inOldAttributes,
+		size_t inCount, size_t inStart, size_t &outLength);
+}
+
+#endif
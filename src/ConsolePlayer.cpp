@@ -0,0 +1,381 @@
+//======================================================================================================
+//
+//	File:		ConsolePlayer.cpp
+//	Created:	Monday, 19 October 2026 18:03:44
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	Replays logs created by ConsoleRecorder.
+//
+//======================================================================================================
+
+#include "ConsolePlayer.h"
+#include "ConsoleRecorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <thread>
+
+using namespace WindowConsole;
+
+// time between keyframes in microseconds
+static const long long KeyframeInterval = 1000000;
+
+static bool ReadVarint(const unsigned char *&ioData, const unsigned char *inEnd, unsigned long long &outValue)
+{
+	outValue = 0;
+	for(int shift = 0; (ioData < inEnd) && (shift < 64); shift += 7)
+	{
+		unsigned char byte = *ioData++;
+		outValue |= (unsigned long long)(byte & 0x7F) << shift;
+		if( (byte & 0x80) == 0 )
+			return true;
+	}
+	return false;
+}
+
+static bool ReadShort(const unsigned char *&ioData, const unsigned char *inEnd, short &outValue)
+{
+	unsigned long long value;
+	if( !ReadVarint(ioData, inEnd, value) )
+		return false;
+	outValue = (short)value;
+	return true;
+}
+
+static bool ReadSigned(const unsigned char *&ioData, const unsigned char *inEnd, long long &outValue)
+{
+	unsigned long long value;
+	if( !ReadVarint(ioData, inEnd, value) )
+		return false;
+	outValue = (long long)(value >> 1) ^ -(long long)(value & 1);
+	return true;
+}
+
+static bool ReadText(const unsigned char *&ioData, const unsigned char *inEnd, std::wstring &outText)
+{
+	unsigned long long length, character;
+	if( !ReadVarint(ioData, inEnd, length) || (length > (unsigned long long)(inEnd - ioData)) )
+		return false;
+
+	outText.resize((size_t)length);
+	for(size_t i = 0; i < outText.length(); ++i)
+	{
+		if( !ReadVarint(ioData, inEnd, character) )
+			return false;
+		outText[i] = (wchar_t)character;
+	}
+	return true;
+}
+
+// memory taken by a keyframe of the given buffer
+static size_t GetKeyframeSize(const VirtualConsole &inScreen)
+{
+	const ConsoleCanvas &canvas = inScreen.GetCanvas();
+	return sizeof(VirtualConsole) + (size_t)canvas.GetWidth() * canvas.GetHeight() * (sizeof(wchar_t) + sizeof(unsigned short));
+}
+
+ConsolePlayer::ConsolePlayer(): mBufferWidth(0), mBufferHeight(0), mDuration(0)
+{  }
+
+ConsolePlayer::~ConsolePlayer()
+{  }
+
+bool ConsolePlayer::Open(const std::string &inPath, size_t inKeyframeMemory)
+{
+	mLog.clear();
+	mKeyframes.clear();
+	mDuration = 0;
+
+	std::ifstream file(inPath.c_str(), std::ios::binary);
+	if( !file.is_open() )
+		return false;
+	mLog.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+	const unsigned char *data = mLog.data();
+	const unsigned char *end = data + mLog.size();
+	if( (mLog.size() < 4) || (data[0] != 'W') || (data[1] != 'C') || (data[2] != 'R') || (data[3] < 1) || (data[3] > 2) )
+	{
+		mLog.clear();
+		return false;
+	}
+	data += 4;
+	if( !ReadShort(data, end, mBufferWidth) || !ReadShort(data, end, mBufferHeight) )
+	{
+		mLog.clear();
+		return false;
+	}
+
+	// keyframe 0 is the empty buffer before the first event
+	Keyframe keyframe;
+	keyframe.state.offset = data - mLog.data();
+	keyframe.state.time = 0;
+	keyframe.state.attribute = 0;
+	keyframe.state.x = 0;
+	keyframe.state.y = 0;
+	keyframe.screen.Create();
+	keyframe.screen.SetBufferSize(mBufferWidth, mBufferHeight);
+	mKeyframes.push_back(keyframe);
+
+	long long interval = KeyframeInterval;
+	size_t memory = GetKeyframeSize(keyframe.screen);
+	VirtualConsole screen = keyframe.screen;
+	DecoderState state = keyframe.state;
+	Event event;
+
+	while( DecodeEvent(state, event) )
+	{
+		Apply(event, screen);
+		if( state.time - mKeyframes.back().state.time < interval )
+			continue;
+
+		keyframe.state = state;
+		keyframe.screen = screen;
+		mKeyframes.push_back(keyframe);
+		memory += GetKeyframeSize(screen);
+
+		// long recordings keep every other keyframe, so keyframes never take more than inKeyframeMemory
+		while( (memory > inKeyframeMemory) && (mKeyframes.size() > 1) )
+		{
+			size_t kept = 1;
+			memory = GetKeyframeSize(mKeyframes.front().screen);
+			for(size_t i = 2; i < mKeyframes.size(); i += 2)
+			{
+				mKeyframes[kept++] = mKeyframes[i];
+				memory += GetKeyframeSize(mKeyframes[i].screen);
+			}
+			mKeyframes.resize(kept);
+			interval *= 2;
+		}
+	}
+
+	// if the log is damaged, only events before the damaged one are kept
+	mLog.resize(state.offset);
+	mDuration = state.time;
+	return true;
+}
+
+long long ConsolePlayer::GetDuration() const
+{
+	return mDuration;
+}
+
+void ConsolePlayer::RenderFrame(const long long &inTime, ConsoleCanvas &outCanvas)
+{
+	if( mKeyframes.empty() )
+	{
+		outCanvas.Resize(0, 0);
+		return;
+	}
+
+	// the last keyframe that is not later than inTime, keyframe 0 is always taken for earlier times
+	size_t keyframe = std::upper_bound(mKeyframes.begin(), mKeyframes.end(), inTime,
+		[](const long long &inTime, const Keyframe &inKeyframe) { return inTime < inKeyframe.state.time; }) - mKeyframes.begin();
+	if( keyframe > 0 )
+		--keyframe;
+
+	VirtualConsole screen = mKeyframes[keyframe].screen;
+	DecoderState state = mKeyframes[keyframe].state;
+	Event event;
+	while( DecodeEvent(state, event) && (event.time <= inTime) )
+	{
+		Apply(event, screen);
+	}
+	outCanvas = screen.GetCanvas();
+}
+
+void ConsolePlayer::Play(Console &ioConsole, double inSpeed)
+{
+	if( mKeyframes.empty() )
+		return;
+
+	// screen is kept only for cells written by Present(), the console has no other way to write them
+	VirtualConsole screen = mKeyframes.front().screen;
+	DecoderState state = mKeyframes.front().state;
+	Event event;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	ioConsole.SetBufferSize(mBufferWidth, mBufferHeight);
+
+	while( DecodeEvent(state, event) )
+	{
+		if( inSpeed > 0 )
+		{
+			std::this_thread::sleep_until(start + std::chrono::microseconds((long long)(event.time / inSpeed)));
+		}
+
+		Apply(event, screen);
+		Dispatch(event, ioConsole, screen);
+	}
+}
+
+void ConsolePlayer::Dispatch(const Event &inEvent, Console &ioConsole, const VirtualConsole &inScreen)
+{
+	ConsoleColor font = (ConsoleColor)(inEvent.attribute & 0x0F);
+	ConsoleColor background = (ConsoleColor)((inEvent.attribute >> 4) & 0x0F);
+
+	switch( inEvent.type )
+	{
+	case ConsoleRecorder::WriteEvent:
+		ioConsole.Write(inEvent.text, font, background);
+		break;
+	case ConsoleRecorder::ReadEvent:
+		// recorder stores text only of reads echoed on the screen, so EchoEvent is not needed here,
+		// and replaying it would only change input mode of the console
+		ioConsole.Writeln(inEvent.text, font, background);
+		break;
+	case ConsoleRecorder::ClearEvent:
+	case ConsoleRecorder::ClearlnEvent:
+		{
+			// buffer is filled with the recorded output color, console can have another one set,
+			// background of Clearln() is the console's, which is recorded with SetRecorder()
+			ConsoleColor outputColor = ioConsole.GetOutputColor();
+			ioConsole.SetOutputColor(font);
+			if( inEvent.type == ConsoleRecorder::ClearEvent )
+				ioConsole.Clear(background);
+			else
+				ioConsole.Clearln();
+			ioConsole.SetOutputColor(outputColor);
+		}
+		break;
+	case ConsoleRecorder::GotoXYEvent:
+		ioConsole.GotoXY(inEvent.x, inEvent.y);
+		break;
+	case ConsoleRecorder::BackgroundColorEvent:
+		ioConsole.SetBackgroudColor((ConsoleColor)inEvent.attribute);
+		break;
+	case ConsoleRecorder::InputColorEvent:
+		ioConsole.SetInputColor((ConsoleColor)inEvent.attribute);
+		break;
+	case ConsoleRecorder::OutputColorEvent:
+		ioConsole.SetOutputColor((ConsoleColor)inEvent.attribute);
+		break;
+	case ConsoleRecorder::BufferSizeEvent:
+		ioConsole.SetBufferSize(inEvent.x, inEvent.y);
+		break;
+	case ConsoleRecorder::CellsEvent:
+		ioConsole.Present(inScreen.GetCanvas());
+		break;
+	}
+}
+
+bool ConsolePlayer::DecodeEvent(DecoderState &ioState, Event &outEvent) const
+{
+	const unsigned char *data = mLog.data() + ioState.offset;
+	const unsigned char *end = mLog.data() + mLog.size();
+	DecoderState state = ioState;
+	unsigned long long value;
+	long long delta = 0;
+
+	if( data >= end )
+		return false;
+
+	outEvent.type = *data++;
+	if( !ReadVarint(data, end, value) )
+		return false;
+	state.time += (long long)value;
+	outEvent.time = state.time;
+	outEvent.x = 0;
+	outEvent.y = 0;
+	outEvent.attribute = 0;
+	outEvent.text.clear();
+	outEvent.attributes.clear();
+
+	bool isValid = true;
+	switch( outEvent.type & ~ConsoleRecorder::SameAttributeFlag )
+	{
+	case ConsoleRecorder::WriteEvent:
+	case ConsoleRecorder::ReadEvent:
+		if( (outEvent.type & ConsoleRecorder::SameAttributeFlag) == 0 )
+		{
+			isValid = ReadVarint(data, end, value);
+			state.attribute = (unsigned short)value;
+		}
+		outEvent.type &= ~ConsoleRecorder::SameAttributeFlag;
+		outEvent.attribute = state.attribute;
+		isValid = isValid && ReadText(data, end, outEvent.text);
+		break;
+
+	case ConsoleRecorder::ClearEvent:
+		isValid = ReadVarint(data, end, value);
+		outEvent.attribute = (unsigned short)value;
+		state.x = 0;
+		state.y = 0;
+		break;
+
+	case ConsoleRecorder::HiddenReadEvent:
+		// only length of the text is stored, nothing was displayed
+		isValid = ReadVarint(data, end, value);
+		break;
+
+	case ConsoleRecorder::ClearlnEvent:
+	case ConsoleRecorder::EchoEvent:
+	case ConsoleRecorder::BackgroundColorEvent:
+	case ConsoleRecorder::InputColorEvent:
+	case ConsoleRecorder::OutputColorEvent:
+	case ConsoleRecorder::KeyEvent:
+		isValid = ReadVarint(data, end, value);
+		outEvent.attribute = (unsigned short)value;
+		break;
+
+	case ConsoleRecorder::GotoXYEvent:
+		isValid = ReadSigned(data, end, delta);
+		state.x = (short)(state.x + delta);
+		isValid = isValid && ReadSigned(data, end, delta);
+		state.y = (short)(state.y + delta);
+		outEvent.x = state.x;
+		outEvent.y = state.y;
+		break;
+
+	case ConsoleRecorder::BufferSizeEvent:
+		isValid = ReadShort(data, end, outEvent.x) && ReadShort(data, end, outEvent.y);
+		break;
+
+	case ConsoleRecorder::CellsEvent:
+		{
+			short count = 0;
+			isValid = ReadShort(data, end, outEvent.x) && ReadShort(data, end, outEvent.y) && ReadShort(data, end, count) &&
+				(count >= 0) && (count <= end - data);
+			for(short i = 0; isValid && (i < count); ++i)
+			{
+				isValid = ReadVarint(data, end, value);
+				outEvent.text.push_back((wchar_t)value);
+			}
+			while( isValid && ((short)outEvent.attributes.size() < count) )
+			{
+				unsigned long long run;
+				isValid = ReadVarint(data, end, run) && ReadVarint(data, end, value) && (run <= (unsigned long long)(count - outEvent.attributes.size()));
+				if( isValid )
+					outEvent.attributes.insert(outEvent.attributes.end(), (size_t)run, (unsigned short)value);
+			}
+		}
+		break;
+
+	default:
+		isValid = false;
+		break;
+	}
+
+	if( !isValid )
+		return false;
+
+	state.offset = data - mLog.data();
+	ioState = state;
+	return true;
+}
+
+void ConsolePlayer::Apply(const Event &inEvent, VirtualConsole &ioScreen)
+{
+	if( inEvent.type == ConsoleRecorder::CellsEvent )
+		ioScreen.WriteCells(inEvent.x, inEvent.y, inEvent.text.data(), inEvent.attributes.data(), (short)inEvent.text.length());
+	else if( inEvent.type == ConsoleRecorder::ClearEvent )
+		ioScreen.ClearBuffer(inEvent.attribute);
+	else if( inEvent.type == ConsoleRecorder::ClearlnEvent )
+		ioScreen.ClearLine(inEvent.attribute);
+	else
+		Dispatch(inEvent, ioScreen, ioScreen);
+}
@@ -0,0 +1,124 @@
+//======================================================================================================
+//
+//	File:		ConsolePlayer.h
+//	Created:	Monday, 19 October 2026 18:03:44
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	Replays logs created by ConsoleRecorder.
+//
+//======================================================================================================
+
+#ifndef __CONSOLEPLAYER_H__
+#define __CONSOLEPLAYER_H__
+#pragma once
+
+#include "Console.h"
+#include "VirtualConsole.h"
+#include "ConsoleCanvas.h"
+
+#include <string>
+#include <vector>
+
+namespace WindowConsole
+{
+	class ConsolePlayer
+	{
+	public:
+
+		/// <summary>
+		/// Constructor. Sets default values for member variables.
+		/// </summary>
+		ConsolePlayer();
+
+
+		/// <summary>
+		/// Destructor. Destroys object and cleans up.
+		/// </summary>
+		~ConsolePlayer();
+
+
+		/// <summary>
+		/// Loads log created by ConsoleRecorder.
+		/// </summary>
+		/// <param>Path of the log file.</param>
+		/// <param>Memory in bytes that can be taken by keyframes.</param>
+		/// <returns>True when succeeded, otherwise false.</returns>
+		/// <remarks>
+		/// Log is kept in memory as it is and events are decoded when they are replayed. The screen is
+		///	saved every second of the recording (keyframe), so RenderFrame() replays at most one second
+		///	of events. When keyframes would take more than inKeyframeMemory, every other one is dropped
+		///	and the interval doubles, e.g. one hour of 80x300 buffer keeps a keyframe every 8 seconds
+		///	with the default 64 MB. If the log is truncated, e.g. application crashed during recording,
+		///	events before the damaged one are loaded.
+		///</remarks>
+		bool Open(const std::string &inPath, size_t inKeyframeMemory = 64 * 1024 * 1024);
+
+
+		/// <summary>
+		/// Returns length of the recording in microseconds.
+		/// </summary>
+		long long GetDuration() const;
+
+
+		/// <summary>
+		/// Replays recording on the console.
+		/// </summary>
+		/// <param>Console that will display the recording.</param>
+		/// <param>Playback speed. 1 is real time, 2 is twice as fast. If it is 0, then events are replayed without waiting.</param>
+		/// <remarks>
+		/// Method returns when all events are replayed. Recorded keys and echo changes are not sent to the console,
+		///	so its input mode stays as it was.
+		///</remarks>
+		void Play(Console &ioConsole, double inSpeed = 1.0);
+
+
+		/// <summary>
+		/// Renders console buffer as it looked at the given time.
+		/// </summary>
+		/// <param>Time in microseconds since the beginning of the recording.</param>
+		/// <param>Canvas that receives the buffer. It is resized to the buffer size.</param>
+		void RenderFrame(const long long &inTime, ConsoleCanvas &outCanvas);
+
+	protected:
+		struct Event
+		{
+			long long time;
+			unsigned char type;
+			short x, y;
+			unsigned short attribute;
+			std::wstring text;
+			std::vector<unsigned short> attributes;
+		};
+
+		// position in the log and values that the following events are relative to
+		struct DecoderState
+		{
+			size_t offset;
+			long long time;
+			unsigned short attribute;
+			short x, y;
+		};
+
+		struct Keyframe
+		{
+			DecoderState state;
+			VirtualConsole screen;
+		};
+
+		bool DecodeEvent(DecoderState &ioState, Event &outEvent) const;
+
+		void Dispatch(const Event &inEvent, Console &ioConsole, const VirtualConsole &inScreen);
+		void Apply(const Event &inEvent, VirtualConsole &ioScreen);
+
+		short mBufferWidth, mBufferHeight;
+		long long mDuration;
+		std::vector<unsigned char> mLog;
+		std::vector<Keyframe> mKeyframes;
+	};
+
+}
+
+#endif
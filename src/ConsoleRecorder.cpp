@@ -0,0 +1,358 @@
+//======================================================================================================
+//
+//	File:		ConsoleRecorder.cpp
+//	Created:	Monday, 19 October 2026 18:03:44
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	Records console output and input to a compact binary log.
+//
+//	Log starts with "WCR", version byte (2, version 1 has no echo events) and varint buffer width and
+//	height. Every event is a type byte, varint time in microseconds since the previous event and the
+//	event's data. Numbers are varints, coordinates of GotoXY are stored as zigzag deltas from the
+//	previous position and text is stored as varint wchar_t values (UTF-16 code units on Windows, code
+//	points where wchar_t has 32 bits), so ASCII takes one byte per character. Text read with echo
+//	disabled is not stored, only its length.
+//
+//======================================================================================================
+
+#include "ConsoleRecorder.h"
+#include "ConsoleCanvas.h"
+
+using namespace WindowConsole;
+
+// events are written to the file when the buffer grows over this size
+static const size_t FlushSize = 64 * 1024;
+
+ConsoleRecorder::ConsoleRecorder(): mLastTime(0), mLastAttribute(0), mLastX(0), mLastY(0),
+	mIsRecording(false), mUseBackgroundThread(false), mIsStopping(false)
+{  }
+
+ConsoleRecorder::~ConsoleRecorder()
+{
+	Stop();
+}
+
+bool ConsoleRecorder::Start(const std::string &inPath, const short &inBufferWidth, const short &inBufferHeight, bool inUseBackgroundThread)
+{
+	Stop();
+
+	mFile.open(inPath.c_str(), std::ios::binary | std::ios::trunc);
+	if( !mFile.is_open() )
+		return false;
+
+	mBuffer.clear();
+	mBuffer.reserve(FlushSize * 2);
+	mPendingBuffer.clear();
+	mStartTime = std::chrono::steady_clock::now();
+	mLastTime = 0;
+	mLastAttribute = 0;
+	mLastX = 0;
+	mLastY = 0;
+	mUseBackgroundThread = inUseBackgroundThread;
+	mIsStopping = false;
+	mIsRecording = true;
+
+	const char magic[] = {'W', 'C', 'R', 2};
+	mBuffer.insert(mBuffer.end(), magic, magic + sizeof(magic));
+	WriteVarint(inBufferWidth);
+	WriteVarint(inBufferHeight);
+
+	if( mUseBackgroundThread )
+		mWriter = std::thread(&ConsoleRecorder::WriterThread, this);
+
+	return true;
+}
+
+void ConsoleRecorder::Stop()
+{
+	if( !mIsRecording )
+		return;
+
+	if( mUseBackgroundThread )
+	{
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mPendingBuffer.insert(mPendingBuffer.end(), mBuffer.begin(), mBuffer.end());
+			mIsStopping = true;
+		}
+		mCondition.notify_one();
+		mWriter.join();
+	}
+	else
+	{
+		mFile.write((const char *)mBuffer.data(), mBuffer.size());
+	}
+
+	mBuffer.clear();
+	mFile.close();
+	mIsRecording = false;
+}
+
+bool ConsoleRecorder::IsRecording() const
+{
+	return mIsRecording;
+}
+
+void ConsoleRecorder::RecordWrite(const std::wstring &inText, unsigned short inAttribute)
+{
+	if( !mIsRecording )
+		return;
+
+	if( inAttribute == mLastAttribute )
+	{
+		BeginEvent(WriteEvent | SameAttributeFlag);
+	}
+	else
+	{
+		BeginEvent(WriteEvent);
+		WriteVarint(inAttribute);
+		mLastAttribute = inAttribute;
+	}
+	WriteText(inText);
+	EndEvent();
+}
+
+void ConsoleRecorder::RecordClear(unsigned short inAttribute)
+{
+	if( !mIsRecording )
+		return;
+
+	BeginEvent(ClearEvent);
+	WriteVarint(inAttribute);
+	mLastX = 0;
+	mLastY = 0;
+	EndEvent();
+}
+
+void ConsoleRecorder::RecordClearln(unsigned short inAttribute)
+{
+	if( !mIsRecording )
+		return;
+
+	BeginEvent(ClearlnEvent);
+	WriteVarint(inAttribute);
+	EndEvent();
+}
+
+void ConsoleRecorder::RecordGotoXY(const short &inX, const short &inY)
+{
+	if( !mIsRecording )
+		return;
+
+	BeginEvent(GotoXYEvent);
+	WriteSigned(inX - mLastX);
+	WriteSigned(inY - mLastY);
+	mLastX = inX;
+	mLastY = inY;
+	EndEvent();
+}
+
+void ConsoleRecorder::RecordBackgroundColor(unsigned short inColor)
+{
+	if( !mIsRecording )
+		return;
+
+	BeginEvent(BackgroundColorEvent);
+	WriteVarint(inColor);
+	EndEvent();
+}
+
+void ConsoleRecorder::RecordInputColor(unsigned short inColor)
+{
+	if( !mIsRecording )
+		return;
+
+	BeginEvent(InputColorEvent);
+	WriteVarint(inColor);
+	EndEvent();
+}
+
+void ConsoleRecorder::RecordOutputColor(unsigned short inColor)
+{
+	if( !mIsRecording )
+		return;
+
+	BeginEvent(OutputColorEvent);
+	WriteVarint(inColor);
+	EndEvent();
+}
+
+void ConsoleRecorder::RecordKey(int inKeyCode)
+{
+	if( !mIsRecording )
+		return;
+
+	BeginEvent(KeyEvent);
+	WriteVarint((unsigned)inKeyCode);
+	EndEvent();
+}
+
+void ConsoleRecorder::RecordRead(const std::wstring &inText, unsigned short inAttribute, bool inIsEchoed)
+{
+	if( !mIsRecording )
+		return;
+
+	// the text was not on the screen, so it is not needed to replay the session and must not leak
+	if( !inIsEchoed )
+	{
+		BeginEvent(HiddenReadEvent);
+		WriteVarint(inText.length());
+		EndEvent();
+		return;
+	}
+
+	if( inAttribute == mLastAttribute )
+	{
+		BeginEvent(ReadEvent | SameAttributeFlag);
+	}
+	else
+	{
+		BeginEvent(ReadEvent);
+		WriteVarint(inAttribute);
+		mLastAttribute = inAttribute;
+	}
+	WriteText(inText);
+	EndEvent();
+}
+
+void ConsoleRecorder::RecordEcho(bool inIsEnabled)
+{
+	if( !mIsRecording )
+		return;
+
+	BeginEvent(EchoEvent);
+	WriteVarint(inIsEnabled ? 1 : 0);
+	EndEvent();
+}
+
+void ConsoleRecorder::RecordBufferSize(const short &inWidth, const short &inHeight)
+{
+	if( !mIsRecording )
+		return;
+
+	BeginEvent(BufferSizeEvent);
+	WriteVarint(inWidth);
+	WriteVarint(inHeight);
+	EndEvent();
+}
+
+void ConsoleRecorder::RecordCells(const short &inX, const short &inY, const wchar_t *inCharacters, const unsigned short *inAttributes, short inCount)
+{
+	if( !mIsRecording )
+		return;
+
+	BeginEvent(CellsEvent);
+	WriteVarint(inX);
+	WriteVarint(inY);
+	WriteVarint(inCount);
+	for(short i = 0; i < inCount; ++i)
+	{
+		WriteVarint((unsigned int)inCharacters[i]);
+	}
+
+	// attributes are stored as runs of the same value
+	for(short i = 0; i < inCount; )
+	{
+		short run = 1;
+		while( (i + run < inCount) && (inAttributes[i + run] == inAttributes[i]) )
+			++run;
+		WriteVarint(run);
+		WriteVarint(inAttributes[i]);
+		i += run;
+	}
+	EndEvent();
+}
+
+void ConsoleRecorder::RecordState(unsigned short inBackgroundColor, unsigned short inInputColor, unsigned short inOutputColor,
+	const short &inCursorX, const short &inCursorY, const ConsoleCanvas &inBuffer)
+{
+	if( !mIsRecording )
+		return;
+
+	// colors go first, changing background on replay remaps the whole buffer
+	RecordBackgroundColor(inBackgroundColor);
+	RecordInputColor(inInputColor);
+	RecordOutputColor(inOutputColor);
+	for(short y = 0; y < inBuffer.GetHeight(); ++y)
+	{
+		RecordCells(0, y, inBuffer.GetRowCharacters(y), inBuffer.GetRowAttributes(y), inBuffer.GetWidth());
+	}
+	RecordGotoXY(inCursorX, inCursorY);
+}
+
+void ConsoleRecorder::BeginEvent(unsigned char inType)
+{
+	long long time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - mStartTime).count();
+
+	mBuffer.push_back(inType);
+	WriteVarint(time - mLastTime);
+	mLastTime = time;
+}
+
+void ConsoleRecorder::WriteVarint(unsigned long long inValue)
+{
+	while( inValue >= 0x80 )
+	{
+		mBuffer.push_back((unsigned char)(inValue | 0x80));
+		inValue >>= 7;
+	}
+	mBuffer.push_back((unsigned char)inValue);
+}
+
+void ConsoleRecorder::WriteSigned(long long inValue)
+{
+	WriteVarint( ((unsigned long long)inValue << 1) ^ (unsigned long long)(inValue >> 63) );
+}
+
+void ConsoleRecorder::WriteText(const std::wstring &inText)
+{
+	WriteVarint(inText.length());
+	for(size_t i = 0; i < inText.length(); ++i)
+	{
+		WriteVarint((unsigned int)inText[i]);
+	}
+}
+
+void ConsoleRecorder::EndEvent()
+{
+	if( mBuffer.size() < FlushSize )
+		return;
+
+	if( mUseBackgroundThread )
+	{
+		// writer thread takes the whole pending buffer at once, so this never waits for the disk
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mPendingBuffer.insert(mPendingBuffer.end(), mBuffer.begin(), mBuffer.end());
+		}
+		mCondition.notify_one();
+	}
+	else
+	{
+		mFile.write((const char *)mBuffer.data(), mBuffer.size());
+	}
+	mBuffer.clear();
+}
+
+void ConsoleRecorder::WriterThread()
+{
+	std::vector<unsigned char> buffer;
+	bool isStopping = false;
+
+	while( !isStopping )
+	{
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			while( mPendingBuffer.empty() && !mIsStopping )
+				mCondition.wait(lock);
+			buffer.swap(mPendingBuffer);
+			isStopping = mIsStopping;
+		}
+
+		mFile.write((const char *)buffer.data(), buffer.size());
+		buffer.clear();
+	}
+}
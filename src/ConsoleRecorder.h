@@ -0,0 +1,226 @@
+//======================================================================================================
+//
+//	File:		ConsoleRecorder.h
+//	Created:	Monday, 19 October 2026 18:03:44
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	Records console output and input to a compact binary log.
+//
+//======================================================================================================
+
+#ifndef __CONSOLERECORDER_H__
+#define __CONSOLERECORDER_H__
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace WindowConsole
+{
+	class ConsoleCanvas;
+
+	class ConsoleRecorder
+	{
+	public:
+
+		/// <summary>
+		/// Type of the recorded event. It is the first byte of every event in the log.
+		/// </summary>
+		enum EventType
+		{
+			WriteEvent = 1,
+			ClearEvent,
+			ClearlnEvent,
+			GotoXYEvent,
+			BackgroundColorEvent,
+			InputColorEvent,
+			OutputColorEvent,
+			KeyEvent,
+			ReadEvent,
+			BufferSizeEvent,
+			CellsEvent,
+			EchoEvent,
+			HiddenReadEvent,
+
+			// set on WriteEvent and ReadEvent when the attribute is the same as in the previous one
+			SameAttributeFlag = 0x80
+		};
+
+
+		/// <summary>
+		/// Constructor. Sets default values for member variables.
+		/// </summary>
+		ConsoleRecorder();
+
+
+		/// <summary>
+		/// Destructor. Stops recording and cleans up.
+		/// </summary>
+		~ConsoleRecorder();
+
+
+		/// <summary>
+		/// Creates the log file and starts recording.
+		/// </summary>
+		/// <param>Path of the log file. Existing file is overwritten.</param>
+		/// <param>Width of the console buffer when recording starts.</param>
+		/// <param>Height of the console buffer when recording starts.</param>
+		/// <param>If true, then the log is written to the file by a background thread.</param>
+		/// <returns>True when succeeded, otherwise false.</returns>
+		/// <remarks>
+		/// Events are collected in memory and written to the file when the buffer is full and when
+		///	recording stops, so Record*() methods do not wait for the disk. With inUseBackgroundThread
+		///	they do not wait even when the buffer is full. Start the recorder before it is set to the
+		///	console, SetRecorder() records colors and buffer of the console (see RecordState()).
+		///</remarks>
+		bool Start(const std::string &inPath, const short &inBufferWidth, const short &inBufferHeight, bool inUseBackgroundThread = false);
+
+
+		/// <summary>
+		/// Writes all recorded events to the file and closes it.
+		/// </summary>
+		void Stop();
+
+
+		/// <summary>
+		/// Returns true between Start() and Stop().
+		/// </summary>
+		bool IsRecording() const;
+
+
+		/// <summary>
+		/// Records text written with Write() or Writeln().
+		/// </summary>
+		/// <param>Written text.</param>
+		/// <param>Attribute used to write the text.</param>
+		void RecordWrite(const std::wstring &inText, unsigned short inAttribute);
+
+
+		/// <summary>
+		/// Records Clear().
+		/// </summary>
+		/// <param>Attribute the buffer was filled with.</param>
+		void RecordClear(unsigned short inAttribute);
+
+
+		/// <summary>
+		/// Records Clearln().
+		/// </summary>
+		/// <param>Attribute the line was filled with.</param>
+		void RecordClearln(unsigned short inAttribute);
+
+
+		/// <summary>
+		/// Records GotoXY().
+		/// </summary>
+		void RecordGotoXY(const short &inX, const short &inY);
+
+
+		/// <summary>
+		/// Records SetBackgroudColor().
+		/// </summary>
+		void RecordBackgroundColor(unsigned short inColor);
+
+
+		/// <summary>
+		/// Records SetInputColor().
+		/// </summary>
+		void RecordInputColor(unsigned short inColor);
+
+
+		/// <summary>
+		/// Records SetOutputColor().
+		/// </summary>
+		void RecordOutputColor(unsigned short inColor);
+
+
+		/// <summary>
+		/// Records key returned by ReadKey().
+		/// </summary>
+		void RecordKey(int inKeyCode);
+
+
+		/// <summary>
+		/// Records text read with Read().
+		/// </summary>
+		/// <param>Read text without the new line.</param>
+		/// <param>Attribute used to echo the text.</param>
+		/// <param>True if the text was echoed on the screen.</param>
+		/// <remarks>
+		/// Text read with echo disabled (e.g. a password) is never written to the log, only its length.
+		///</remarks>
+		void RecordRead(const std::wstring &inText, unsigned short inAttribute, bool inIsEchoed);
+
+
+		/// <summary>
+		/// Records EnableEcho() and DisableEcho().
+		/// </summary>
+		/// <param>True if echo is enabled.</param>
+		void RecordEcho(bool inIsEnabled);
+
+
+		/// <summary>
+		/// Records SetBufferSize().
+		/// </summary>
+		void RecordBufferSize(const short &inWidth, const short &inHeight);
+
+
+		/// <summary>
+		/// Records cells written directly to the buffer by Present().
+		/// </summary>
+		/// <param>The X coordinate of the first cell.</param>
+		/// <param>The Y coordinate of the first cell.</param>
+		/// <param>Characters of the cells.</param>
+		/// <param>Attributes of the cells.</param>
+		/// <param>Number of cells.</param>
+		void RecordCells(const short &inX, const short &inY, const wchar_t *inCharacters, const unsigned short *inAttributes, short inCount);
+
+
+
+		/// <summary>
+		/// Records colors, cursor position and buffer of the console.
+		/// </summary>
+		/// <param>Background color.</param>
+		/// <param>Input color.</param>
+		/// <param>Output color.</param>
+		/// <param>The X coordinate of the cursor.</param>
+		/// <param>The Y coordinate of the cursor.</param>
+		/// <param>Buffer of the console.</param>
+		/// <remarks>
+		/// Console calls it in SetRecorder() when the recorder is already started, so the log does not
+		///	depend on what was written before. Buffer is stored as CellsEvent for every line.
+		///</remarks>
+		void RecordState(unsigned short inBackgroundColor, unsigned short inInputColor, unsigned short inOutputColor,
+			const short &inCursorX, const short &inCursorY, const ConsoleCanvas &inBuffer);
+
+	protected:
+		void BeginEvent(unsigned char inType);
+		void WriteVarint(unsigned long long inValue);
+		void WriteSigned(long long inValue);
+		void WriteText(const std::wstring &inText);
+		void EndEvent();
+		void WriterThread();
+
+		std::ofstream mFile;
+		std::vector<unsigned char> mBuffer, mPendingBuffer;
+		std::chrono::steady_clock::time_point mStartTime;
+		long long mLastTime;
+		unsigned short mLastAttribute;
+		short mLastX, mLastY;
+		bool mIsRecording, mUseBackgroundThread, mIsStopping;
+		std::thread mWriter;
+		std::mutex mMutex;
+		std::condition_variable mCondition;
+	};
+
+}
+
+#endif
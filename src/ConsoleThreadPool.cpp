@@ -0,0 +1,111 @@
+//======================================================================================================
+//
+//	File:		ConsoleThreadPool.cpp
+//	Created:	Tuesday, 20 October 2026 09:41:52
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	Threads that stay alive between frames and run the same task at once.
+//
+//======================================================================================================
+
+#include "ConsoleThreadPool.h"
+
+#include <algorithm>
+#include <system_error>
+
+using namespace WindowConsole;
+
+ConsoleThreadPool & ConsoleThreadPool::GetInstance()
+{
+	static ConsoleThreadPool pool;
+	return pool;
+}
+
+ConsoleThreadPool::ConsoleThreadPool(): mTask(NULL), mGeneration(0), mWaitingCount(0), mRunningCount(0), mIsStopping(false)
+{  }
+
+ConsoleThreadPool::~ConsoleThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mIsStopping = true;
+	}
+	mStartCondition.notify_all();
+
+	for(size_t i = 0; i < mThreads.size(); ++i)
+	{
+		mThreads[i].join();
+	}
+}
+
+unsigned ConsoleThreadPool::Run(const std::function<void()> &inTask, unsigned inThreadCount)
+{
+	std::unique_lock<std::mutex> runLock(mRunMutex, std::try_to_lock);
+	if( !runLock.owns_lock() || (inThreadCount <= 1) )
+	{
+		inTask();
+		return 1;
+	}
+
+	unsigned helperCount = inThreadCount - 1;
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		// threads are started once and wait for the next task, a thread that cannot be started is not retried now
+		try
+		{
+			while( mThreads.size() < helperCount )
+				mThreads.emplace_back(&ConsoleThreadPool::WorkerThread, this);
+		}
+		catch(const std::system_error &)
+		{
+		}
+
+		helperCount = std::min<unsigned>(helperCount, (unsigned)mThreads.size());
+		mTask = &inTask;
+		mWaitingCount = helperCount;
+		mRunningCount = helperCount;
+		++mGeneration;
+	}
+	mStartCondition.notify_all();
+
+	inTask();
+
+	std::unique_lock<std::mutex> lock(mMutex);
+	while( mRunningCount > 0 )
+		mDoneCondition.wait(lock);
+	mTask = NULL;
+
+	return helperCount + 1;
+}
+
+void ConsoleThreadPool::WorkerThread()
+{
+	std::unique_lock<std::mutex> lock(mMutex);
+
+	// every task is taken once, by the first mWaitingCount threads that wake up,
+	// thread started by Run() has not seen any task yet, so it can take the current one
+	unsigned long long generation = 0;
+
+	while( true )
+	{
+		while( !mIsStopping && ( (generation == mGeneration) || (mWaitingCount == 0) ) )
+			mStartCondition.wait(lock);
+		if( mIsStopping )
+			return;
+
+		generation = mGeneration;
+		--mWaitingCount;
+		const std::function<void()> *task = mTask;
+
+		lock.unlock();
+		(*task)();
+		lock.lock();
+
+		if( --mRunningCount == 0 )
+			mDoneCondition.notify_all();
+	}
+}
@@ -0,0 +1,78 @@
+//======================================================================================================
+//
+//	File:		ConsoleThreadPool.h
+//	Created:	Tuesday, 20 October 2026 09:41:52
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	Threads that stay alive between frames and run the same task at once.
+//
+//======================================================================================================
+
+#ifndef __CONSOLETHREADPOOL_H__
+#define __CONSOLETHREADPOOL_H__
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace WindowConsole
+{
+	class ConsoleThreadPool
+	{
+	public:
+
+		/// <summary>
+		/// Returns pool shared by all canvases.
+		/// </summary>
+		static ConsoleThreadPool & GetInstance();
+
+
+		/// <summary>
+		/// Constructor. Threads are started by the first Run() that needs them.
+		/// </summary>
+		ConsoleThreadPool();
+
+
+		/// <summary>
+		/// Destructor. Stops and joins all threads.
+		/// </summary>
+		~ConsoleThreadPool();
+
+
+		/// <summary>
+		/// Runs the task on many threads at once and waits until all of them return.
+		/// </summary>
+		/// <param>Task that is run by every thread. It must not throw.</param>
+		/// <param>Number of threads, including the calling one.</param>
+		/// <returns>Number of threads that ran the task.</returns>
+		/// <remarks>
+		/// Calling thread always runs the task too, so it runs with fewer threads (or only on the
+		///	calling one) when threads cannot be started. Pool runs one task at a time. If it is busy,
+		///	e.g. Run() is called from a task, then the task runs only on the calling thread.
+		///</remarks>
+		unsigned Run(const std::function<void()> &inTask, unsigned inThreadCount);
+
+	protected:
+		ConsoleThreadPool(const ConsoleThreadPool &);
+		ConsoleThreadPool & operator=(const ConsoleThreadPool &);
+
+		void WorkerThread();
+
+		std::vector<std::thread> mThreads;
+		const std::function<void()> *mTask;
+		unsigned long long mGeneration;
+		unsigned mWaitingCount, mRunningCount;
+		bool mIsStopping;
+		std::mutex mMutex, mRunMutex;
+		std::condition_variable mStartCondition, mDoneCondition;
+	};
+
+}
+
+#endif
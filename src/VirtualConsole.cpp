@@ -0,0 +1,486 @@
+//======================================================================================================
+//
+//	File:		VirtualConsole.cpp
+//	Created:	Monday, 19 October 2026 21:26:17
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	In-memory implementation of Console.
+//
+//======================================================================================================
+
+#include "VirtualConsole.h"
+#include "ConsoleCellWidth.h"
+#include "ConsoleKernels.h"
+#include "ConsoleRecorder.h"
+
+#include <algorithm>
+
+using namespace WindowConsole;
+
+static const short LargestWidth = 240;
+static const short LargestHeight = 67;
+
+VirtualConsole::VirtualConsole(): mWidth(80), mHeight(25), mBufferWidth(80), mBufferHeight(300),
+	mCursorX(0), mCursorY(0), mCaption(L""), mIsCursorVisible(true), mIsWindowVisible(true), mIsEchoEnabled(true),
+	mCursorSize(25), mInputColor(ConsoleColor::DarkWhite), mOutputColor(ConsoleColor::DarkWhite),
+	mBackgroudColor(ConsoleColor::Black), mInputBufferSize(1024), mNextInputLine(0), mNextKey(0), mRecorder(NULL)
+{  }
+
+VirtualConsole::~VirtualConsole()
+{  }
+
+void VirtualConsole::Create()
+{
+	mCanvas.Resize(mBufferWidth, mBufferHeight);
+	mCursorX = 0;
+	mCursorY = 0;
+}
+
+void VirtualConsole::Destroy()
+{
+	mCanvas.Resize(0, 0);
+	mInputLines.clear();
+	mKeys.clear();
+	mNextInputLine = 0;
+	mNextKey = 0;
+}
+
+bool VirtualConsole::SetCaption(const std::wstring &inCaption)
+{
+	mCaption = inCaption;
+	return true;
+}
+
+std::wstring VirtualConsole::GetCaption()
+{
+	return mCaption;
+}
+
+void VirtualConsole::GotoXY(const short &inX, const short &inY)
+{
+	if( (inX < 0) || (inX >= mBufferWidth) || (inY < 0) || (inY >= mBufferHeight) )
+		return;
+
+	mCursorX = inX;
+	mCursorY = inY;
+	if( mRecorder )
+		mRecorder->RecordGotoXY(inX, inY);
+}
+
+bool VirtualConsole::HideCursor()
+{
+	if( mIsCursorVisible )
+	{
+		mIsCursorVisible = false;
+		return true;
+	}
+	return false;
+}
+
+bool VirtualConsole::ShowCursor()
+{
+	if( !mIsCursorVisible )
+	{
+		mIsCursorVisible = true;
+		return true;
+	}
+	return false;
+}
+
+bool VirtualConsole::SetCursorSize(const char &inSize)
+{
+	if( inSize>100 )
+		mCursorSize = 100;
+	else
+		mCursorSize = inSize;
+	return true;
+}
+
+char VirtualConsole::GetCursorSize()
+{
+	return mCursorSize;
+}
+
+HWND VirtualConsole::GetWindowHandle()
+{
+	return NULL;
+}
+
+bool VirtualConsole::ShowConsoleWindow()
+{
+	if( !mIsWindowVisible )
+	{
+		mIsWindowVisible = true;
+		return true;
+	}
+	return false;
+}
+
+bool VirtualConsole::HideConsoleWindow()
+{
+	if( mIsWindowVisible )
+	{
+		mIsWindowVisible = false;
+		return true;
+	}
+	return false;
+}
+
+bool VirtualConsole::SetWindowsSize(const short &inWidth, const short &inHeight)
+{
+	if( (inWidth < 1) || (inWidth > LargestWidth) || (inHeight < 1) || (inHeight > LargestHeight) )
+		return false;
+
+	mWidth = inWidth;
+	mHeight = inHeight;
+	return SetBufferSize(mWidth, mHeight);
+}
+
+COORD VirtualConsole::GetWindowSize()
+{
+	COORD temp = {mWidth, mHeight};
+	return temp;
+}
+
+COORD VirtualConsole::GetLargestWindowSize()
+{
+	COORD size = {LargestWidth, LargestHeight};
+	return size;
+}
+
+void VirtualConsole::SetBackgroudColor(ConsoleColor inBackgroundColor)
+{
+	mBackgroudColor = inBackgroundColor;
+	RemapBackground(mCanvas.GetAttributes(), (unsigned short)mBackgroudColor, mCanvas.GetWidth() * mCanvas.GetHeight());
+	if( mRecorder )
+		mRecorder->RecordBackgroundColor((unsigned short)mBackgroudColor);
+}
+
+void VirtualConsole::SetInputColor(ConsoleColor inInputColor)
+{
+	mInputColor = inInputColor;
+	if( mRecorder )
+		mRecorder->RecordInputColor((unsigned short)mInputColor);
+}
+
+void VirtualConsole::SetOutputColor(ConsoleColor inOutputColor)
+{
+	mOutputColor = inOutputColor;
+	if( mRecorder )
+		mRecorder->RecordOutputColor((unsigned short)mOutputColor);
+}
+
+ConsoleColor VirtualConsole::GetBackgroudColor()
+{
+	return mBackgroudColor;
+}
+
+ConsoleColor VirtualConsole::GetInputColor()
+{
+	return mInputColor;
+}
+
+ConsoleColor VirtualConsole::GetOutputColor()
+{
+	return mOutputColor;
+}
+
+void VirtualConsole::Write(const std::wstring &inText, ConsoleColor inOutputColor, ConsoleColor inBackgroundColor)
+{
+	if( inOutputColor == ConsoleColor::None )
+	{
+		inOutputColor = mOutputColor;
+	}
+	if( inBackgroundColor == ConsoleColor::None )
+	{
+		inBackgroundColor = mBackgroudColor;
+	}
+	unsigned short attribute = ( (inBackgroundColor & 0x0F) << 4) + (inOutputColor & 0x0F);
+	Put(inText, attribute);
+	if( mRecorder )
+		mRecorder->RecordWrite(inText, attribute);
+}
+
+void VirtualConsole::Writeln(const std::wstring &inText, ConsoleColor inOutputColor, ConsoleColor inBackgroundColor)
+{
+	Write(inText + L"\r\n", inOutputColor, inBackgroundColor);
+}
+
+void VirtualConsole::Clear(ConsoleColor inBackgroundColor)
+{
+	if( inBackgroundColor == ConsoleColor::None )
+	{
+		inBackgroundColor = mBackgroudColor;
+	}
+	ClearBuffer(((inBackgroundColor & 0x0F) << 4) + (mOutputColor & 0x0F));
+}
+
+void VirtualConsole::Clearln()
+{
+	ClearLine(((mBackgroudColor & 0x0F) << 4) + (mOutputColor & 0x0F));
+}
+
+bool VirtualConsole::SetBufferSize(const short &inWidth, const short &inHeight)
+{
+	if( (inWidth < 1) || (inHeight < 1) )
+		return false;
+
+	mBufferWidth = inWidth;
+	mBufferHeight = inHeight;
+
+	// part of the old buffer that fits into the new one is kept
+	ConsoleCanvas canvas(mBufferWidth, mBufferHeight);
+	short width = std::min<short>(mCanvas.GetWidth(), mBufferWidth);
+	short height = std::min<short>(mCanvas.GetHeight(), mBufferHeight);
+	for(short y = 0; y < height; ++y)
+	{
+		std::copy(mCanvas.GetRowCharacters(y), mCanvas.GetRowCharacters(y) + width, canvas.GetRowCharacters(y));
+		std::copy(mCanvas.GetRowAttributes(y), mCanvas.GetRowAttributes(y) + width, canvas.GetRowAttributes(y));
+	}
+	mCanvas = canvas;
+	mCursorX = std::min<short>(mCursorX, mBufferWidth - 1);
+	mCursorY = std::min<short>(mCursorY, mBufferHeight - 1);
+
+	if( mRecorder )
+		mRecorder->RecordBufferSize(mBufferWidth, mBufferHeight);
+	return true;
+}
+
+COORD VirtualConsole::GetBufferSize()
+{
+	COORD temp = {mBufferWidth, mBufferHeight};
+	return temp;
+}
+
+void VirtualConsole::Read(std::wstring &outBuffor, ConsoleColor inInputColor, ConsoleColor inBackgroundColor)
+{
+	if( inInputColor == ConsoleColor::None )
+	{
+		inInputColor = mInputColor;
+	}
+	if( inBackgroundColor == ConsoleColor::None )
+	{
+		inBackgroundColor = mBackgroudColor;
+	}
+
+	outBuffor.clear();
+	if( mNextInputLine >= mInputLines.size() )
+		return;
+
+	// two characters of the input buffer are taken by the new line
+	outBuffor = mInputLines[mNextInputLine++].substr(0, std::max<int>(mInputBufferSize - 2, 0));
+
+	// read lines are removed when they are half of the queue, so reading is amortized O(1)
+	if( mNextInputLine * 2 >= mInputLines.size() )
+	{
+		mInputLines.erase(mInputLines.begin(), mInputLines.begin() + mNextInputLine);
+		mNextInputLine = 0;
+	}
+
+	unsigned short attribute = ( (inBackgroundColor & 0x0F) << 4) + (inInputColor & 0x0F);
+	if( mIsEchoEnabled )
+		Put(outBuffor + L"\r\n", attribute);
+	if( mRecorder )
+		mRecorder->RecordRead(outBuffor, attribute, mIsEchoEnabled);
+}
+
+void VirtualConsole::SetInputBufferSize(const short &inSize)
+{
+	mInputBufferSize = inSize;
+}
+
+short VirtualConsole::GetInputBufferSize()
+{
+	return mInputBufferSize;
+}
+
+int VirtualConsole::ReadKey()
+{
+	if( mNextKey >= mKeys.size() )
+		return 0;
+
+	int returnCode = mKeys[mNextKey++];
+	if( mNextKey * 2 >= mKeys.size() )
+	{
+		mKeys.erase(mKeys.begin(), mKeys.begin() + mNextKey);
+		mNextKey = 0;
+	}
+	if( mRecorder )
+		mRecorder->RecordKey(returnCode);
+	return returnCode;
+}
+
+void VirtualConsole::EnableEcho()
+{
+	mIsEchoEnabled = true;
+	if( mRecorder )
+		mRecorder->RecordEcho(true);
+}
+
+void VirtualConsole::DisableEcho()
+{
+	mIsEchoEnabled = false;
+	if( mRecorder )
+		mRecorder->RecordEcho(false);
+}
+
+void VirtualConsole::Present(const ConsoleCanvas &inCanvas)
+{
+	short height = std::min<short>(inCanvas.GetHeight(), mCanvas.GetHeight());
+	for(short y = 0; y < height; ++y)
+	{
+		WriteCells(0, y, inCanvas.GetRowCharacters(y), inCanvas.GetRowAttributes(y), inCanvas.GetWidth());
+	}
+}
+
+void VirtualConsole::SetRecorder(ConsoleRecorder *inRecorder)
+{
+	mRecorder = inRecorder;
+	if( mRecorder && mRecorder->IsRecording() )
+	{
+		mRecorder->RecordState((unsigned short)mBackgroudColor, (unsigned short)mInputColor, (unsigned short)mOutputColor,
+			mCursorX, mCursorY, mCanvas);
+	}
+}
+
+ConsoleRecorder * VirtualConsole::GetRecorder()
+{
+	return mRecorder;
+}
+
+void VirtualConsole::PushInput(const std::wstring &inLine)
+{
+	mInputLines.push_back(inLine);
+}
+
+void VirtualConsole::PushKey(int inKeyCode)
+{
+	mKeys.push_back(inKeyCode);
+}
+
+COORD VirtualConsole::GetCursorPosition()
+{
+	COORD temp = {mCursorX, mCursorY};
+	return temp;
+}
+
+const ConsoleCanvas & VirtualConsole::GetCanvas() const
+{
+	return mCanvas;
+}
+
+void VirtualConsole::ClearBuffer(unsigned short inAttribute)
+{
+	mCanvas.Fill(L' ', inAttribute);
+	mCursorX = 0;
+	mCursorY = 0;
+	if( mRecorder )
+		mRecorder->RecordClear(inAttribute);
+}
+
+void VirtualConsole::ClearLine(unsigned short inAttribute)
+{
+	if( mCursorY < mCanvas.GetHeight() )
+	{
+		FillCharacters(mCanvas.GetRowCharacters(mCursorY), L' ', mCanvas.GetWidth());
+		FillAttributes(mCanvas.GetRowAttributes(mCursorY), inAttribute, mCanvas.GetWidth());
+	}
+	mCursorX = 0;
+	if( mRecorder )
+		mRecorder->RecordClearln(inAttribute);
+}
+
+void VirtualConsole::WriteCells(const short &inX, const short &inY, const wchar_t *inCharacters, const unsigned short *inAttributes, short inCount)
+{
+	if( (inY < 0) || (inY >= mCanvas.GetHeight()) || (inX < 0) || (inX >= mCanvas.GetWidth()) )
+		return;
+
+	short count = std::min<short>(inCount, mCanvas.GetWidth() - inX);
+	std::copy(inCharacters, inCharacters + count, mCanvas.GetRowCharacters(inY) + inX);
+	std::copy(inAttributes, inAttributes + count, mCanvas.GetRowAttributes(inY) + inX);
+	if( mRecorder )
+		mRecorder->RecordCells(inX, inY, inCharacters, inAttributes, count);
+}
+
+void VirtualConsole::Put(const std::wstring &inText, unsigned short inAttribute)
+{
+	const short width = mCanvas.GetWidth();
+	const short height = mCanvas.GetHeight();
+
+	if( (width == 0) || (height == 0) )
+		return;
+
+	const wchar_t *text = inText.data();
+	size_t length = inText.length();
+
+	while( length > 0 )
+	{
+		int clusterWidth;
+		size_t units = GetCluster(text, length, clusterWidth);
+		wchar_t character = text[0];
+
+		if( character == L'\r' )
+		{
+			mCursorX = 0;
+		}
+		else if( character == L'\n' )
+		{
+			mCursorX = 0;
+			++mCursorY;
+		}
+		else if( character == L'\b' )
+		{
+			if( mCursorX > 0 )
+				--mCursorX;
+		}
+		else if( character == L'\t' )
+		{
+			mCursorX = std::min<short>((mCursorX / 8 + 1) * 8, width - 1);
+		}
+		else if( clusterWidth > 0 )
+		{
+			// wide character that does not fit into the line is moved to the next one
+			if( mCursorX + clusterWidth > width )
+			{
+				mCanvas.SetCell(mCursorX, mCursorY, L' ', inAttribute);
+				mCursorX = 0;
+				++mCursorY;
+				Scroll(inAttribute);
+			}
+
+			mCanvas.SetCluster(mCursorX, mCursorY, text, units, clusterWidth, inAttribute);
+			mCursorX = (short)(mCursorX + clusterWidth);
+			if( mCursorX >= width )
+			{
+				mCursorX = 0;
+				++mCursorY;
+			}
+		}
+
+		Scroll(inAttribute);
+		text += units;
+		length -= units;
+	}
+}
+
+void VirtualConsole::Scroll(unsigned short inAttribute)
+{
+	const short width = mCanvas.GetWidth();
+	const short height = mCanvas.GetHeight();
+
+	// writing below the last line scrolls buffer up
+	if( mCursorY >= height )
+	{
+		size_t shift = (size_t)(mCursorY - height + 1) * width;
+		size_t cells = (size_t)width * height;
+		shift = std::min<size_t>(shift, cells);
+		std::copy(mCanvas.GetCharacters() + shift, mCanvas.GetCharacters() + cells, mCanvas.GetCharacters());
+		std::copy(mCanvas.GetAttributes() + shift, mCanvas.GetAttributes() + cells, mCanvas.GetAttributes());
+		FillCharacters(mCanvas.GetCharacters() + cells - shift, L' ', shift);
+		FillAttributes(mCanvas.GetAttributes() + cells - shift, inAttribute, shift);
+		mCursorY = height - 1;
+	}
+}
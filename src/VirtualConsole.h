@@ -0,0 +1,173 @@
+//======================================================================================================
+//
+//	File:		VirtualConsole.h
+//	Created:	Monday, 19 October 2026 21:26:17
+//
+//	Copyright (c) 2026 Michal Tynior. All Rights Reserved.
+//
+//------------------------------------------------------------------------------------------------------
+//
+//	In-memory implementation of Console.
+//
+//======================================================================================================
+
+#ifndef __VIRTUALCONSOLE_H__
+#define __VIRTUALCONSOLE_H__
+#pragma once
+
+#include "Console.h"
+#include "ConsoleCanvas.h"
+
+#include <string>
+#include <vector>
+
+namespace WindowConsole
+{
+	/// <summary>
+	/// Console that keeps its buffer, cursor and input in memory.
+	/// </summary>
+	/// <remarks>
+	/// VirtualConsole behaves like WindowsConsole, but it does not need a console window or Windows at
+	///	all. It can be used to run many sessions of a console application at once, e.g. in load tests.
+	///	Input is sent with PushInput() and PushKey() and the buffer is read with GetCanvas().
+	///	Object is cheap: constructor does not allocate memory, Create() allocates only the buffer and
+	///	input queues allocate when input is pushed.
+	///
+	///	Differences from WindowsConsole:
+	///	- Write() processes text like WriteConsole(): '\r', '\n', '\b', '\t' and '\a' move the cursor,
+	///	  text wraps at the end of the line and buffer scrolls up when the cursor goes below the last
+	///	  line. Wide characters take two cells and combining marks none, see ConsoleCanvas::SetCluster().
+	///	- Read() returns the next line sent with PushInput() and never waits. If there is no input,
+	///	  then the line is empty. Lines longer than the input buffer size are cut.
+	///	- ReadKey() returns the next key sent with PushKey(), or 0 if there is none.
+	///	- GotoXY() ignores positions outside of the buffer.
+	///	- SetWindowsSize() resizes window and buffer to the same size, SetBufferSize() keeps the part
+	///	  of the buffer that fits into the new size.
+	///	- GetLargestWindowSize() is fixed to 240x67 characters and GetWindowHandle() returns NULL.
+	///	- Cursor and window methods only keep their state, SetCaption() and SetCursorSize() always
+	///	  return true.
+	///</remarks>
+	class VirtualConsole : public Console
+	{
+	public:
+
+		/// <summary>
+		/// Constructor. Sets default values for member variables.
+		/// </summary>
+		VirtualConsole();
+
+
+		/// <summary>
+		/// Destructor. Destroys object and cleans up.
+		/// </summary>
+		~VirtualConsole();
+
+		void Create() override;
+		void Destroy() override;
+		bool SetCaption(const std::wstring &inCaption) override;
+		std::wstring GetCaption() override;
+		void GotoXY(const short &inX, const short &inY) override;
+		bool HideCursor() override;
+		bool ShowCursor() override;
+		bool SetCursorSize(const char &inSize) override;
+		char GetCursorSize() override;
+		HWND GetWindowHandle() override;
+		bool ShowConsoleWindow() override;
+		bool HideConsoleWindow() override;
+		bool SetWindowsSize(const short &inWidth, const short &inHeight) override;
+		COORD GetWindowSize() override;
+		COORD GetLargestWindowSize() override;
+		void SetBackgroudColor(ConsoleColor inBackgroundColor) override;
+		void SetInputColor(ConsoleColor inInputColor) override;
+		void SetOutputColor(ConsoleColor inOutputColor) override;
+		ConsoleColor GetBackgroudColor() override;
+		ConsoleColor GetInputColor() override;
+		ConsoleColor GetOutputColor() override;
+		void Write(const std::wstring &inText, ConsoleColor inOutputColor = ConsoleColor::None, ConsoleColor inBackgroundColor = ConsoleColor::None) override;
+		void Writeln(const std::wstring &inText, ConsoleColor inOutputColor = ConsoleColor::None, ConsoleColor inBackgroundColor = ConsoleColor::None) override;
+		void Clear(ConsoleColor inBackgroundColor = ConsoleColor::None) override;
+		void Clearln() override;
+		bool SetBufferSize(const short &inWidth, const short &inHeight) override;
+		COORD GetBufferSize() override;
+		void Read(std::wstring &outBuffor, ConsoleColor inInputColor = ConsoleColor::None, ConsoleColor inBackgroundColor = ConsoleColor::None) override;
+		void SetInputBufferSize(const short &inSize) override;
+		short GetInputBufferSize() override;
+		int ReadKey() override;
+		void EnableEcho() override;
+		void DisableEcho() override;
+		void Present(const ConsoleCanvas &inCanvas) override;
+		void SetRecorder(ConsoleRecorder *inRecorder) override;
+		ConsoleRecorder * GetRecorder() override;
+
+
+		/// <summary>
+		/// Adds line to the input. It is returned by the next Read().
+		/// </summary>
+		/// <param>Line without the new line characters.</param>
+		void PushInput(const std::wstring &inLine);
+
+
+		/// <summary>
+		/// Adds key to the input. It is returned by the next ReadKey().
+		/// </summary>
+		/// <param>Virtual key code, e.g. 27 for ESC.</param>
+		void PushKey(int inKeyCode);
+
+
+		/// <summary>
+		/// Returns position of the cursor.
+		/// </summary>
+		COORD GetCursorPosition();
+
+
+		/// <summary>
+		/// Returns the buffer. Canvas has the size of the buffer.
+		/// </summary>
+		const ConsoleCanvas & GetCanvas() const;
+
+
+		/// <summary>
+		/// Writes cells directly to the buffer, without moving the cursor.
+		/// </summary>
+		/// <param>The X coordinate of the first cell.</param>
+		/// <param>The Y coordinate of the first cell.</param>
+		/// <param>Characters of the cells.</param>
+		/// <param>Attributes of the cells.</param>
+		/// <param>Number of cells. Cells behind the end of the line are skipped.</param>
+		void WriteCells(const short &inX, const short &inY, const wchar_t *inCharacters, const unsigned short *inAttributes, short inCount);
+
+
+		/// <summary>
+		/// Clears buffer like Clear(), but fills it with the given attribute.
+		/// </summary>
+		/// <param>Attribute of all cells, background color in the upper four bits.</param>
+		void ClearBuffer(unsigned short inAttribute);
+
+
+		/// <summary>
+		/// Clears line where is a cursor like Clearln(), but fills it with the given attribute.
+		/// </summary>
+		/// <param>Attribute of the cells of the line.</param>
+		void ClearLine(unsigned short inAttribute);
+
+	protected:
+		void Put(const std::wstring &inText, unsigned short inAttribute);
+		void Scroll(unsigned short inAttribute);
+
+		short mWidth, mHeight, mBufferWidth, mBufferHeight;
+		short mCursorX, mCursorY;
+		std::wstring mCaption;
+		bool mIsCursorVisible, mIsWindowVisible, mIsEchoEnabled;
+		char mCursorSize;
+		ConsoleColor mInputColor, mOutputColor, mBackgroudColor;
+		unsigned short mInputBufferSize;
+		ConsoleCanvas mCanvas;
+		std::vector<std::wstring> mInputLines;
+		std::vector<int> mKeys;
+		size_t mNextInputLine, mNextKey;
+		ConsoleRecorder *mRecorder;
+	};
+
+}
+
+#endif
@@ -12,13 +12,19 @@
 //======================================================================================================
 
 #include "WindowsConsole.h"
+#include "ConsoleCellWidth.h"
+#include "ConsoleKernels.h"
+#include "ConsoleRecorder.h"
+
+#include <algorithm>
 
 using namespace WindowConsole;
 
 WindowsConsole::WindowsConsole(): mHInput(0), mHOutput(0), mHOldOutput(0),
 	mWidth(80), mHeight(25), mBufferWidth(80), mBufferHeight(300),
 	mCaption(L""), mIsCursorVisible(true), mIsWindowVisible(true), mCursorSize(25), mInputBuffer(NULL), mInputBufferSize(1024),
-	mBackgroudColor(ConsoleColor::Black), mInputColor(ConsoleColor::DarkWhite), mOutputColor(ConsoleColor::DarkWhite)
+	mBackgroudColor(ConsoleColor::Black), mInputColor(ConsoleColor::DarkWhite), mOutputColor(ConsoleColor::DarkWhite),
+	mIsPresentedValid(false), mRecorder(NULL)
 {  }
 
 WindowsConsole::~WindowsConsole()
@@ -65,6 +71,8 @@ void WindowsConsole::GotoXY(const short &inX, const short &inY)
 {
 	COORD position = {inX, inY};
 	SetConsoleCursorPosition(mHOutput, position);
+	if( mRecorder )
+		mRecorder->RecordGotoXY(inX, inY);
 }
 
 bool WindowsConsole::HideCursor()
@@ -197,34 +205,33 @@ COORD WindowsConsole::GetLargestWindowSize()
 void WindowsConsole::SetBackgroudColor(ConsoleColor inBackgroundColor)
 {
 	mBackgroudColor = inBackgroundColor;
-	wchar_t * buffer = new wchar_t[mBufferWidth * mBufferHeight];
 	WORD *attrBuffer = new WORD[mBufferWidth * mBufferHeight];
 	COORD startPos = {0, 0};
 	DWORD lenght;
 
+	// only attributes change, characters stay where they are
 	ReadConsoleOutputAttribute(mHOutput, attrBuffer, mBufferWidth * mBufferHeight, startPos, &lenght);
-	ReadConsoleOutputCharacterW(mHOutput, buffer, mBufferWidth * mBufferHeight, startPos, &lenght);
-
-	for(int i = 0; i < (mBufferWidth * mBufferHeight); ++i)
-	{
-		WORD outColor = (attrBuffer[i] & 0x0F);
-		attrBuffer[i] = ( ( (mBackgroudColor & 0x0F) << 4) + (outColor & 0x0F) );
-	}
-
+	RemapBackground(attrBuffer, (unsigned short)mBackgroudColor, mBufferWidth * mBufferHeight);
 	WriteConsoleOutputAttribute(mHOutput, attrBuffer, (mBufferWidth * mBufferHeight), startPos, &lenght);
-	WriteConsoleOutputCharacterW(mHOutput, buffer, (mBufferWidth * mBufferHeight), startPos, &lenght);
 	delete [] attrBuffer;
-	delete [] buffer;
+
+	if( mRecorder )
+		mRecorder->RecordBackgroundColor((unsigned short)mBackgroudColor);
+	RemapBackground(mPresentedCanvas.GetAttributes(), (unsigned short)mBackgroudColor, mPresentedCanvas.GetWidth() * mPresentedCanvas.GetHeight());
 }
 
 void WindowsConsole::SetInputColor(ConsoleColor inInputColor)
 {
 	mInputColor = inInputColor;
+	if( mRecorder )
+		mRecorder->RecordInputColor((unsigned short)mInputColor);
 }
 
 void WindowsConsole::SetOutputColor(ConsoleColor inOutputColor)
 {
 	mOutputColor = inOutputColor;
+	if( mRecorder )
+		mRecorder->RecordOutputColor((unsigned short)mOutputColor);
 }
 
 
@@ -254,8 +261,11 @@ void WindowsConsole::Write(const std::wstring &inText, ConsoleColor inOutputColo
 	{
 		inBackgroundColor = mBackgroudColor;
 	}
+	mIsPresentedValid = false;
 	SetConsoleTextAttribute(mHOutput, ( (inBackgroundColor & 0x0F) << 4) + (inOutputColor & 0x0F) );
 	WriteConsole(mHOutput, inText.data(), (DWORD)inText.length(), &lenght, NULL);	
+	if( mRecorder )
+		mRecorder->RecordWrite(inText, ( (inBackgroundColor & 0x0F) << 4) + (inOutputColor & 0x0F) );
 }
 
 void WindowsConsole::Writeln(const std::wstring &inText, ConsoleColor inOutputColor, ConsoleColor inBackgroundColor)
@@ -290,6 +300,9 @@ void WindowsConsole::Clear(ConsoleColor inBackgroundColor)
         // fill buffer with empty spaces
         FillConsoleOutputCharacter(mHOutput, (TCHAR) 32, csbi.dwSize.X * csbi.dwSize.Y, coord, &count);
         FillConsoleOutputAttribute(mHOutput, csbi.wAttributes, csbi.dwSize.X * csbi.dwSize.Y, coord, &count );
+		mPresentedCanvas.Fill(L' ', csbi.wAttributes);
+		if( mRecorder )
+			mRecorder->RecordClear(csbi.wAttributes);
         
 		// set new cursor's position
 		SetConsoleCursorPosition(mHOutput, coord);
@@ -322,6 +335,13 @@ void WindowsConsole::Clearln()
 		// fill buffer with empty spaces
 		FillConsoleOutputCharacter(mHOutput, (TCHAR) 32, mBufferWidth, coord, &count);
 		FillConsoleOutputAttribute(mHOutput, csbi.wAttributes, mBufferWidth, coord, &count );
+		if( coord.Y < mPresentedCanvas.GetHeight() )
+		{
+			FillCharacters(mPresentedCanvas.GetRowCharacters(coord.Y), L' ', mPresentedCanvas.GetWidth());
+			FillAttributes(mPresentedCanvas.GetRowAttributes(coord.Y), csbi.wAttributes, mPresentedCanvas.GetWidth());
+		}
+		if( mRecorder )
+			mRecorder->RecordClearln(csbi.wAttributes);
         
 		// set new cursor's position
 		SetConsoleCursorPosition(mHOutput, coord);
@@ -332,9 +352,12 @@ bool WindowsConsole::SetBufferSize(const short &inWidth, const short &inHeight)
 {
 	mBufferWidth = inWidth;
 	mBufferHeight = inHeight;	
+	mIsPresentedValid = false;
 	COORD bufferCoord = {mBufferWidth, mBufferHeight};
 	if( !SetConsoleScreenBufferSize(mHOutput, bufferCoord) )
 		return false;
+	if( mRecorder )
+		mRecorder->RecordBufferSize(mBufferWidth, mBufferHeight);
 	return true;
 }
 
@@ -356,10 +379,18 @@ void WindowsConsole::Read(std::wstring &outBuffor, ConsoleColor inInputColor, Co
 	}
 
 	DWORD lenght;	
+	mIsPresentedValid = false;
 	SetConsoleTextAttribute(mHOutput, ( (inBackgroundColor & 0x0F) << 4) + (inInputColor & 0x0F) );
 	ReadConsole( mHInput, mInputBuffer, mInputBufferSize, &lenght, 0 );
 	outBuffor.clear();
 	outBuffor = std::wstring(mInputBuffer, lenght - 2);	
+	if( mRecorder )
+	{
+		// echo may be changed outside of EnableEcho() and DisableEcho(), so the console is asked
+		DWORD mode = 0;
+		GetConsoleMode(mHInput, &mode);
+		mRecorder->RecordRead(outBuffor, ( (inBackgroundColor & 0x0F) << 4) + (inInputColor & 0x0F), (mode & ENABLE_ECHO_INPUT) != 0);
+	}
 }
 
 void WindowsConsole::SetInputBufferSize(const short &inSize)
@@ -392,6 +423,8 @@ int WindowsConsole::ReadKey()
 	}	
 
 	delete eventBuffer;
+	if( mRecorder && (returnCode != 0) )
+		mRecorder->RecordKey(returnCode);
 	return returnCode;
 }
 
@@ -399,10 +432,122 @@ void WindowsConsole::EnableEcho()
 {
 	DWORD mode = mConsoleMode |ENABLE_ECHO_INPUT | ENABLE_LINE_INPUT;
 	SetConsoleMode(mHInput, mode);
+	if( mRecorder )
+		mRecorder->RecordEcho(true);
 }
 
 void WindowsConsole::DisableEcho()
 {
 	DWORD mode = mConsoleMode & ~(ENABLE_ECHO_INPUT);
 	SetConsoleMode(mHInput, mode);
+	if( mRecorder )
+		mRecorder->RecordEcho(false);
+}
+
+static void WriteCells(HANDLE inHOutput, const wchar_t *inCharacters, const unsigned short *inAttributes, short inCount, COORD inPosition)
+{
+	DWORD lenght;
+	WriteConsoleOutputAttribute(inHOutput, inAttributes, inCount, inPosition, &lenght);
+
+	if( std::find_if(inAttributes, inAttributes + inCount, [](unsigned short inAttribute) { return (inAttribute & TrailingCellFlag) != 0; }) == inAttributes + inCount )
+	{
+		WriteConsoleOutputCharacterW(inHOutput, inCharacters, inCount, inPosition, &lenght);
+		return;
+	}
+
+	// console puts wide character on two cells itself, so trailing cells are skipped unless they keep a low surrogate
+	std::wstring characters;
+	characters.reserve(inCount);
+	for(short i = 0; i < inCount; ++i)
+	{
+		if( !(inAttributes[i] & TrailingCellFlag) || ( (inCharacters[i] >= 0xDC00) && (inCharacters[i] <= 0xDFFF) ) )
+			characters.push_back(inCharacters[i]);
+	}
+	WriteConsoleOutputCharacterW(inHOutput, characters.data(), (DWORD)characters.length(), inPosition, &lenght);
+}
+
+void WindowsConsole::Present(const ConsoleCanvas &inCanvas)
+{
+	// WriteConsoleOutput* wraps to the next line, so cells behind the buffer's edge are skipped
+	const short width = std::min<short>(inCanvas.GetWidth(), mBufferWidth);
+	const short height = std::min<short>(inCanvas.GetHeight(), mBufferHeight);
+
+	// console may contain anything, so whole canvas is written
+	if( !mIsPresentedValid || (mPresentedCanvas.GetWidth() != inCanvas.GetWidth()) || (mPresentedCanvas.GetHeight() != inCanvas.GetHeight()) )
+	{
+		mPresentedCanvas = inCanvas;
+		for(short y = 0; y < height; ++y)
+		{
+			COORD position = {0, y};
+			WriteCells(mHOutput, inCanvas.GetRowCharacters(y), inCanvas.GetRowAttributes(y), width, position);
+			if( mRecorder )
+				mRecorder->RecordCells(0, y, inCanvas.GetRowCharacters(y), inCanvas.GetRowAttributes(y), width);
+		}
+		mIsPresentedValid = true;
+		return;
+	}
+
+	for(short y = 0; y < height; ++y)
+	{
+		const wchar_t *characters = inCanvas.GetRowCharacters(y);
+		const unsigned short *attributes = inCanvas.GetRowAttributes(y);
+		wchar_t *oldCharacters = mPresentedCanvas.GetRowCharacters(y);
+		unsigned short *oldAttributes = mPresentedCanvas.GetRowAttributes(y);
+		size_t length;
+		size_t first = FindChangedRun(characters, attributes, oldCharacters, oldAttributes, width, 0, length);
+
+		while( first < (size_t)width )
+		{
+			// runs separated by a few equal cells are written at once, one call is more expensive than a few cells
+			size_t last = first + length;
+			size_t nextLength;
+			size_t next = FindChangedRun(characters, attributes, oldCharacters, oldAttributes, width, last, nextLength);
+			while( (next < (size_t)width) && (next - last < 8) )
+			{
+				last = next + nextLength;
+				next = FindChangedRun(characters, attributes, oldCharacters, oldAttributes, width, last, nextLength);
+			}
+
+			// wide character is always written as a whole
+			if( (first > 0) && (attributes[first] & TrailingCellFlag) )
+				--first;
+			if( (last < (size_t)width) && (attributes[last - 1] & LeadingCellFlag) )
+				++last;
+
+			COORD position = {(short)first, y};
+			WriteCells(mHOutput, characters + first, attributes + first, (short)(last - first), position);
+			if( mRecorder )
+				mRecorder->RecordCells((short)first, y, characters + first, attributes + first, (short)(last - first));
+			std::copy(characters + first, characters + last, oldCharacters + first);
+			std::copy(attributes + first, attributes + last, oldAttributes + first);
+
+			first = next;
+			length = nextLength;
+		}
+	}
+}
+
+void WindowsConsole::SetRecorder(ConsoleRecorder *inRecorder)
+{
+	mRecorder = inRecorder;
+	if( !mRecorder || !mRecorder->IsRecording() )
+		return;
+
+	// the log starts with what is on the screen now, so it can be replayed without the earlier session
+	CONSOLE_SCREEN_BUFFER_INFO info;
+	if( !GetConsoleScreenBufferInfo(mHOutput, &info) )
+		return;
+
+	ConsoleCanvas buffer(info.dwSize.X, info.dwSize.Y);
+	COORD startPos = {0, 0};
+	DWORD lenght;
+	ReadConsoleOutputCharacterW(mHOutput, buffer.GetCharacters(), info.dwSize.X * info.dwSize.Y, startPos, &lenght);
+	ReadConsoleOutputAttribute(mHOutput, buffer.GetAttributes(), info.dwSize.X * info.dwSize.Y, startPos, &lenght);
+	mRecorder->RecordState((unsigned short)mBackgroudColor, (unsigned short)mInputColor, (unsigned short)mOutputColor,
+		info.dwCursorPosition.X, info.dwCursorPosition.Y, buffer);
+}
+
+ConsoleRecorder * WindowsConsole::GetRecorder()
+{
+	return mRecorder;
 }
\ No newline at end of file